@@ -0,0 +1,61 @@
+# Builds reference configurations of the library with MinSizeRel and reports code size of libBitParser.a
+# together with benchmark_config throughput. Invoked by the size_report target:
+#   cmake -DSOURCE_DIR=<src> -DBINARY_DIR=<dir> -DC_COMPILER=<cc> -DLIBRARY_NAME=<lib> -P SizeReport.cmake
+
+# Field lists are comma separated, so each of them stays a single command line argument.
+set(INTEGER_FIELDS "U8,I8,S8,U16,I16,S16,U32,I32,S32,U64,I64,S64,LEN,ARRAY_FIXED,ARRAY_VARIABLE,ALIGN,PAD")
+set(MINIMAL_FIELDS "U8,U16,U32,LEN,ARRAY_VARIABLE")
+
+set(CONFIGS full integers minimal big_only little_only validated byte_api)
+set(full_ARGS)
+set(integers_ARGS -DBIT_PARSER_FIELDS=${INTEGER_FIELDS})
+set(minimal_ARGS -DBIT_PARSER_FIELDS=${MINIMAL_FIELDS} -DBIT_PARSER_MODES=BIG -DBIT_PARSER_BYTE_API=OFF)
+set(big_only_ARGS -DBIT_PARSER_MODES=BIG)
+set(little_only_ARGS -DBIT_PARSER_MODES=LITTLE)
+set(validated_ARGS -DBIT_PARSER_VALIDATED=ON)
+set(byte_api_ARGS -DBIT_PARSER_BIT_API=OFF)
+
+find_program(SIZE_TOOL NAMES size llvm-size)
+if(NOT SIZE_TOOL)
+    message(FATAL_ERROR "size tool not found")
+endif()
+
+set(REPORT "| configuration | text | data | bss | serialize [ns/msg] | deserialize [ns/msg] |\n")
+string(APPEND REPORT "|---|---:|---:|---:|---:|---:|\n")
+
+foreach(config ${CONFIGS})
+    set(dir ${BINARY_DIR}/${config})
+
+    execute_process(COMMAND ${CMAKE_COMMAND} -S ${SOURCE_DIR} -B ${dir} -DCMAKE_BUILD_TYPE=MinSizeRel
+                            -DCMAKE_C_COMPILER=${C_COMPILER} ${${config}_ARGS}
+                    OUTPUT_QUIET RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Configuring ${config} failed")
+    endif()
+
+    execute_process(COMMAND ${CMAKE_COMMAND} --build ${dir} --target BitParser benchmark_config
+                    OUTPUT_QUIET RESULT_VARIABLE result)
+    if(NOT result EQUAL 0)
+        message(FATAL_ERROR "Building ${config} failed")
+    endif()
+
+    execute_process(COMMAND ${SIZE_TOOL} -t ${dir}/src/${LIBRARY_NAME}
+                    OUTPUT_VARIABLE size_output RESULT_VARIABLE result)
+    if(NOT result EQUAL 0 OR NOT size_output MATCHES "\n[ \t]*([0-9]+)[ \t]+([0-9]+)[ \t]+([0-9]+)[^\n]*\\(TOTALS\\)")
+        message(FATAL_ERROR "Measuring ${config} size failed")
+    endif()
+    set(text ${CMAKE_MATCH_1})
+    set(data ${CMAKE_MATCH_2})
+    set(bss  ${CMAKE_MATCH_3})
+
+    execute_process(COMMAND ${dir}/examples/benchmark_config OUTPUT_VARIABLE bench_output RESULT_VARIABLE result)
+    if(NOT result EQUAL 0 OR NOT bench_output MATCHES "serialize +([0-9.]+) ns/msg\ndeserialize +([0-9.]+) ns/msg")
+        message(FATAL_ERROR "Benchmarking ${config} failed")
+    endif()
+
+    string(APPEND REPORT "| ${config} | ${text} | ${data} | ${bss} | ${CMAKE_MATCH_1} | ${CMAKE_MATCH_2} |\n")
+endforeach()
+
+file(WRITE ${BINARY_DIR}/size_report.md "${REPORT}")
+message("${REPORT}")
+message("Report written to ${BINARY_DIR}/size_report.md")
@@ -0,0 +1,115 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "Stream.h"
+#include "UParser.h"
+
+#if defined(BIT_PARSER_BIT_API_ENABLED) && defined(BIT_FIELD_U8_ENABLED) && defined(BIT_FIELD_U16_ENABLED) && \
+    defined(BIT_FIELD_U32_ENABLED) && defined(BIT_FIELD_LEN_ENABLED) && defined(BIT_FIELD_ARRAY_VARIABLE_ENABLED)
+#define USE_BIT_PARSER
+#include "BitParser.h"
+#endif
+
+#ifdef BIT_PARSER_MODE_BIG_ENABLED
+#define MODE BIG
+#else
+#define MODE LITTLE
+#endif
+
+#define NO_MESSAGES  1000000
+#define PAYLOAD_LEN  16
+#define MESSAGE_LEN  (8 + PAYLOAD_LEN)
+
+typedef struct {
+    uint8_t   id;
+    uint16_t  sequence;
+    uint32_t  time;
+    size_t    len;
+    uint8_t * data;
+} Message_T;
+
+#ifdef USE_BIT_PARSER
+static const BitField_T message_desc[] = {
+    BIT_FIELD_U8(8, Message_T, id),
+    BIT_FIELD_U16(16, Message_T, sequence),
+    BIT_FIELD_U32(32, Message_T, time),
+    BIT_FIELD_LEN(8, Message_T, len),
+    BIT_FIELD_ARRAY_VARIABLE(Message_T, data, len),
+};
+#endif
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static Status_T Serialize(Message_T * p_message, Stream_T * p_stream) {
+#if defined(USE_BIT_PARSER)
+    return BitParser_Serialize(message_desc, ARRAY_LEN(message_desc), p_message, p_stream);
+#elif defined(BIT_PARSER_BIT_API_ENABLED)
+    Status_T result = U8_SerializeBit(&p_message->id, 8, p_stream);
+    result |= U16_SerializeBit(&p_message->sequence, 16, p_stream);
+    result |= U32_SerializeBit(&p_message->time, 32, p_stream);
+    result |= Size_SerializeBit(&p_message->len, 8, p_stream);
+    return result | Array_SerializeBit(p_message->data, p_message->len, p_stream);
+#else
+    Status_T result = U8_Serialize(&p_message->id, p_stream);
+    result |= U16_Serialize(&p_message->sequence, p_stream);
+    result |= U32_Serialize(&p_message->time, p_stream);
+    result |= Size_Serialize(&p_message->len, 1, p_stream);
+    return result | Array_Serialize(p_message->data, p_message->len, p_stream);
+#endif
+}
+
+static Status_T Deserialize(Message_T * p_message, Stream_T * p_stream) {
+#if defined(USE_BIT_PARSER)
+    return BitParser_Deserialize(message_desc, ARRAY_LEN(message_desc), p_message, p_stream);
+#elif defined(BIT_PARSER_BIT_API_ENABLED)
+    Status_T result = U8_DeserializeBit(&p_message->id, 8, p_stream);
+    result |= U16_DeserializeBit(&p_message->sequence, 16, p_stream);
+    result |= U32_DeserializeBit(&p_message->time, 32, p_stream);
+    result |= Size_DeserializeBit(&p_message->len, 8, p_stream);
+    return result | Array_DeserializeBit(p_message->data, p_message->len, p_stream);
+#else
+    Status_T result = U8_Deserialize(&p_message->id, p_stream);
+    result |= U16_Deserialize(&p_message->sequence, p_stream);
+    result |= U32_Deserialize(&p_message->time, p_stream);
+    result |= Size_Deserialize(&p_message->len, 1, p_stream);
+    return result | Array_Deserialize(p_message->data, p_message->len, p_stream);
+#endif
+}
+
+int main() {
+    uint8_t   payload[PAYLOAD_LEN] = {0};
+    uint8_t   output[PAYLOAD_LEN];
+    uint8_t   buffer[MESSAGE_LEN];
+    Message_T message = {.id = 0x5A, .sequence = 0x1234, .time = 0xDEADBEEF, .len = sizeof(payload), .data = payload};
+    Message_T decoded = {.data = output};
+    Stream_T  stream;
+
+    double start = now();
+    for(size_t i = 0; i < NO_MESSAGES; i++) {
+        message.sequence = (uint16_t) i;
+        Stream_Init(&stream, buffer, sizeof(buffer), MODE);
+        if(Serialize(&message, &stream) != STATUS_SUCCESS)
+            return 1;
+    }
+    double serialize = now() - start;
+
+    start = now();
+    for(size_t i = 0; i < NO_MESSAGES; i++) {
+        Stream_Init(&stream, buffer, sizeof(buffer), MODE);
+        if(Deserialize(&decoded, &stream) != STATUS_SUCCESS)
+            return 1;
+    }
+    double deserialize = now() - start;
+
+    if(decoded.sequence != message.sequence || memcmp(output, payload, sizeof(payload)) != 0)
+        return 1;
+
+    printf("serialize    %8.1f ns/msg\n", serialize / NO_MESSAGES * 1e9);
+    printf("deserialize  %8.1f ns/msg\n", deserialize / NO_MESSAGES * 1e9);
+}
@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "BitParallel.h"
+
+#define NO_RECORDS (4u * 1024u * 1024u)
+#define RECORD_LEN 8u
+
+typedef struct {
+    uint16_t sensor1;
+    uint16_t sensor2;
+    uint8_t  type;
+    uint8_t  alarm;
+    uint32_t time;
+} Record_T;
+
+static const BitField_T record_desc[] = {
+    BIT_FIELD_U16(12, Record_T, sensor1),
+    BIT_FIELD_U16(12, Record_T, sensor2),
+    BIT_FIELD_U8(3, Record_T, type),
+    BIT_FIELD_U8(5, Record_T, alarm),
+    BIT_FIELD_U32(32, Record_T, time),
+};
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main(int argc, char ** argv) {
+    long max_threads = argc > 1 ? atol(argv[1]) : sysconf(_SC_NPROCESSORS_ONLN);
+    if(max_threads < 1)
+        max_threads = 1;
+
+    uint8_t *  input  = malloc(NO_RECORDS * RECORD_LEN);
+    Record_T * output = malloc(NO_RECORDS * sizeof(Record_T));
+    if(input == NULL || output == NULL)
+        return 1;
+
+    for(size_t i = 0; i < NO_RECORDS * RECORD_LEN; i++)
+        input[i] = (uint8_t) (i * 131u);
+
+    BitBatch_T batch = {
+        .p_buffer    = input,
+        .len         = NO_RECORDS * RECORD_LEN,
+        .mode        = BIG,
+        .record_len  = RECORD_LEN,
+        .no_records  = NO_RECORDS,
+        .p_output    = output,
+        .output_size = sizeof(Record_T),
+    };
+
+    double base = 0;
+    printf("threads  time[s]  records/s  speedup\n");
+    for(long threads = 1; threads <= max_threads; threads++) {
+        double start = now();
+        Status_T ret = BitParallel_DeserializeBatch(record_desc, ARRAY_LEN(record_desc), &batch, threads, 0);
+        double elapsed = now() - start;
+        if(ret != STATUS_SUCCESS)
+            return 1;
+
+        if(threads == 1)
+            base = elapsed;
+
+        printf("%7ld  %7.3f  %9.0f  %7.2f\n", threads, elapsed, NO_RECORDS / elapsed, base / elapsed);
+    }
+
+    free(input);
+    free(output);
+}
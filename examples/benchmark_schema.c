@@ -0,0 +1,59 @@
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+
+#include "BitSchema.h"
+
+#define NO_SCHEMAS 100000u
+
+static const char schema_text[] =
+    "struct header {\n"
+    "    u8 4 version\n"
+    "    u8 4 type\n"
+    "    u16 16 id be\n"
+    "}\n"
+    "u16 12 sensor1\n"
+    "u16 12 sensor2\n"
+    "u8 3 alarm\n"
+    "pad 5\n"
+    "u32 32 time le\n"
+    "len 8 len\n"
+    "bytes len data\n"
+    "float value\n";
+
+static double now(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+int main() {
+    static BitField_T image[32];
+    BitField_T        fields[16];
+    BitSchema_T       schema;
+
+    double start = now();
+    for(size_t i = 0; i < NO_SCHEMAS; i++) {
+        if(BitSchema_Parse(&schema, schema_text, sizeof(schema_text) - 1, fields, ARRAY_LEN(fields), NULL) !=
+           STATUS_SUCCESS)
+            return 1;
+    }
+    double parse = now() - start;
+
+    if(BitSchema_Save(&schema, (uint8_t *) image, sizeof(image)) != STATUS_SUCCESS)
+        return 1;
+
+    start = now();
+    for(size_t i = 0; i < NO_SCHEMAS; i++) {
+        if(BitSchema_Map(&schema, image, BIT_SCHEMA_IMAGE_SIZE(schema.no_fields)) != STATUS_SUCCESS)
+            return 1;
+    }
+    double map = now() - start;
+
+    printf("fields  struct size  image size\n");
+    printf("%6zu  %11zu  %10zu\n\n", schema.no_fields, schema.size, BIT_SCHEMA_IMAGE_SIZE(schema.no_fields));
+    printf("load   time[ns]/schema\n");
+    printf("parse  %15.1f\n", parse / NO_SCHEMAS * 1e9);
+    printf("map    %15.1f\n", map / NO_SCHEMAS * 1e9);
+}
@@ -0,0 +1,768 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+/*
+ * Differential fuzz target. A random flat descriptor and a random message are built from input bytes and
+ * run, in both BIG and LITTLE modes, through the reference engine, ie. field by field calls of
+ * BitParser_SerializeField and BitParser_DeserializeField, and through every optimized path of the library:
+ * native runs of BitParser_Serialize and BitParser_Deserialize, nested and flattened descriptors, selected
+ * and arena deserialization, length profiles, lazy views, patching, transcoding and compiled filters.
+ * Any difference in serialized bits, decoded values, lengths, offsets or statuses aborts.
+ *
+ * Built with BIT_PARSER_LIBFUZZER it is a libFuzzer target. Otherwise it is a standalone program, which
+ * runs given number of iterations on pseudo random inputs, or replays input files given as arguments:
+ *
+ *   fuzz_differential [iterations [seed]]
+ *   fuzz_differential file...
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <math.h>
+
+#include "BitParser.h"
+#include "BitArena.h"
+#include "BitFilter.h"
+#include "BitPatch.h"
+#include "BitTranscode.h"
+#include "BitView.h"
+#include "UParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+#define MAX_FIELDS   24
+#define MAX_ARRAY    32
+#define MAX_LEN_BIT  6
+#define MAX_INPUT    1024
+#define RECORD_SIZE  (MAX_FIELDS * sizeof(uint64_t))
+#define BUFFER_SIZE  (MAX_FIELDS * MAX_ARRAY)
+
+#define CHECK(cond)                                                                         \
+    do {                                                                                    \
+        if(!(cond)) {                                                                       \
+            fprintf(stderr, "%s:%d: %s failed, %s mode\n", __FILE__, __LINE__, #cond,       \
+                    mode == BIG ? "BIG" : "LITTLE");                                        \
+            abort();                                                                        \
+        }                                                                                   \
+    } while(0)
+
+/**
+ * Fuzzer input consumed byte by byte. Exhausted input reads as zeros.
+ */
+typedef struct {
+    const uint8_t * p_data;     /*!< Input bytes. */
+    size_t          len;        /*!< Number of input bytes. */
+    size_t          index;      /*!< Index of the next byte. */
+} Input_T;
+
+/**
+ * Generated descriptor.
+ */
+typedef struct {
+    BitField_T fields[MAX_FIELDS];  /*!< Flat descriptor. */
+    size_t     no_fields;           /*!< Number of fields. */
+    size_t     size;                /*!< Size of message struct in bytes. */
+} Case_T;
+
+/**
+ * Message struct described by generated descriptor, with storage for its arrays.
+ */
+typedef struct {
+    _Alignas(max_align_t) uint8_t data[RECORD_SIZE];    /*!< Message struct. */
+    uint8_t arrays[MAX_FIELDS][MAX_ARRAY];              /*!< Array of every field, pointed by the struct. */
+} Record_T;
+
+/**
+ * Get next input byte.
+ *
+ * @param p_input   Input.
+ * @return          Input byte, 0 if input is exhausted.
+ */
+static uint8_t Next(Input_T * p_input);
+
+/**
+ * Allocate a member of message struct, aligned to its size.
+ *
+ * @param p_case    Descriptor.
+ * @param size      Member size in bytes.
+ * @return          Member offset.
+ */
+static size_t Allocate(Case_T * p_case, size_t size);
+
+/**
+ * Generate random byte order override valid for given width.
+ *
+ * @param p_input   Input.
+ * @param bit       Field width in bits.
+ * @return          Byte order.
+ */
+static BitOrder_T GenerateOrder(Input_T * p_input, size_t bit);
+
+/**
+ * Set type, offset and width of integer, FLOAT or DOUBLE field.
+ *
+ * @param p_field   Field to set.
+ * @param type      Field type.
+ * @param offset    Member offset.
+ * @param bit       Field width in bits, ignored for FLOAT and DOUBLE.
+ */
+static void SetValueField(BitField_T * p_field, BitFieldType_T type, size_t offset, size_t bit);
+
+/**
+ * Generate random valid flat descriptor. Integer, FLOAT, DOUBLE, LEN, ARRAY_FIXED, ARRAY_VARIABLE, ALIGN
+ * and PAD fields are generated, with random widths and byte order overrides.
+ *
+ * @param p_case    Output descriptor.
+ * @param p_input   Input.
+ */
+static void Generate(Case_T * p_case, Input_T * p_input);
+
+/**
+ * Fill message struct with random values. LEN values never exceed array storage.
+ *
+ * @param p_case    Descriptor.
+ * @param p_record  Record to fill.
+ * @param p_input   Input.
+ */
+static void Fill(const Case_T * p_case, Record_T * p_record, Input_T * p_input);
+
+/**
+ * Clear message struct and point its array fields to its own array storage.
+ *
+ * @param p_case    Descriptor.
+ * @param p_record  Record to bind.
+ */
+static void Bind(const Case_T * p_case, Record_T * p_record);
+
+/**
+ * Reference serialization, field by field.
+ *
+ * @param p_case    Descriptor.
+ * @param data      Message struct.
+ * @param p_stream  Stream to write data.
+ * @param p_offsets Output stream bit index of every field and of message end, may be NULL.
+ * @return          Status.
+ */
+static Status_T ReferenceSerialize(const Case_T * p_case, uint8_t * data, Stream_T * p_stream, size_t * p_offsets);
+
+/**
+ * Reference deserialization, field by field.
+ *
+ * @param p_case    Descriptor.
+ * @param data      Message struct.
+ * @param p_stream  Stream to read data.
+ * @return          Status.
+ */
+static Status_T ReferenceDeserialize(const Case_T * p_case, uint8_t * data, Stream_T * p_stream);
+
+/**
+ * Compare decoded values of two message structs. Arrays are compared by content.
+ *
+ * @param p_case    Descriptor.
+ * @param a         First message struct.
+ * @param b         Second message struct.
+ * @return          True if all values are equal.
+ */
+static bool Equal(const Case_T * p_case, uint8_t * a, uint8_t * b);
+
+/**
+ * Check if message has a FLOAT or DOUBLE NaN value. Conversions of signaling NaN quiet it.
+ *
+ * @param p_case    Descriptor.
+ * @param data      Message struct.
+ * @return          True if any floating point value is NaN.
+ */
+static bool HasNan(const Case_T * p_case, const uint8_t * data);
+
+/**
+ * Run a message through reference and optimized engines in given mode and compare results.
+ *
+ * @param p_case    Descriptor.
+ * @param p_message Message.
+ * @param mode      Stream mode.
+ * @param p_input   Input, for random choices of checks.
+ */
+static void Check(const Case_T * p_case, Record_T * p_message, Stream_Mode_T mode, Input_T * p_input);
+
+int LLVMFuzzerTestOneInput(const uint8_t * p_data, size_t len) {
+    Input_T  input = {.p_data = p_data, .len = len};
+    Case_T   test_case;
+    Record_T message;
+
+    Generate(&test_case, &input);
+    Bind(&test_case, &message);
+    Fill(&test_case, &message, &input);
+
+    Stream_Mode_T mode = BIG;
+    CHECK(BitParser_Validate(test_case.fields, test_case.no_fields) == STATUS_SUCCESS);
+
+    Check(&test_case, &message, BIG, &input);
+    Check(&test_case, &message, LITTLE, &input);
+
+    return 0;
+}
+
+#ifndef BIT_PARSER_LIBFUZZER
+int main(int argc, char ** argv) {
+    static uint8_t input[MAX_INPUT];
+
+    char * p_end;
+    unsigned long iterations = argc > 1 ? strtoul(argv[1], &p_end, 10) : 10000;
+
+    if(argc > 1 && *p_end != '\0') {
+        for(int i = 1; i < argc; i++) {
+            FILE * p_file = fopen(argv[i], "rb");
+            if(p_file == NULL) {
+                fprintf(stderr, "Cannot open %s\n", argv[i]);
+                return 1;
+            }
+
+            size_t len = fread(input, 1, sizeof(input), p_file);
+            fclose(p_file);
+
+            LLVMFuzzerTestOneInput(input, len);
+        }
+
+        printf("%d inputs passed\n", argc - 1);
+        return 0;
+    }
+
+    uint64_t state = argc > 2 ? strtoull(argv[2], NULL, 10) : 1;
+    if(state == 0)
+        state = 1;
+
+    for(unsigned long i = 0; i < iterations; i++) {
+        /* xorshift64 */
+        for(size_t j = 0; j < sizeof(input); j++) {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            input[j] = (uint8_t) state;
+        }
+
+        LLVMFuzzerTestOneInput(input, input[0] * sizeof(input) / UINT8_MAX);
+    }
+
+    printf("%lu iterations passed\n", iterations);
+    return 0;
+}
+#endif
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static uint8_t Next(Input_T * p_input) {
+    return p_input->index < p_input->len ? p_input->p_data[p_input->index++] : 0;
+}
+
+static size_t Allocate(Case_T * p_case, size_t size) {
+    size_t offset = (p_case->size + size - 1) / size * size;
+
+    p_case->size = offset + size;
+    return offset;
+}
+
+static BitOrder_T GenerateOrder(Input_T * p_input, size_t bit) {
+    BitOrder_T order = (BitOrder_T) (Next(p_input) % (BIT_ORDER_WORD_SWAPPED + 1));
+
+    if(bit % BITS_IN_BYTE != 0 || (order == BIT_ORDER_WORD_SWAPPED && bit % (2 * BITS_IN_BYTE) != 0))
+        return BIT_ORDER_STREAM;
+
+    return order;
+}
+
+static void SetValueField(BitField_T * p_field, BitFieldType_T type, size_t offset, size_t bit) {
+    p_field->field_type = type;
+
+    switch(type) {
+        case U8:
+            p_field->u8_f.offset = offset;
+            p_field->u8_f.bit    = bit;
+            break;
+
+        case I8:
+            p_field->i8_f.offset = offset;
+            p_field->i8_f.bit    = bit;
+            break;
+
+        case S8:
+            p_field->s8_f.offset = offset;
+            p_field->s8_f.bit    = bit;
+            break;
+
+        case U16:
+            p_field->u16_f.offset = offset;
+            p_field->u16_f.bit    = bit;
+            break;
+
+        case I16:
+            p_field->i16_f.offset = offset;
+            p_field->i16_f.bit    = bit;
+            break;
+
+        case S16:
+            p_field->s16_f.offset = offset;
+            p_field->s16_f.bit    = bit;
+            break;
+
+        case U32:
+            p_field->u32_f.offset = offset;
+            p_field->u32_f.bit    = bit;
+            break;
+
+        case I32:
+            p_field->i32_f.offset = offset;
+            p_field->i32_f.bit    = bit;
+            break;
+
+        case S32:
+            p_field->s32_f.offset = offset;
+            p_field->s32_f.bit    = bit;
+            break;
+
+        case U64:
+            p_field->u64_f.offset = offset;
+            p_field->u64_f.bit    = bit;
+            break;
+
+        case I64:
+            p_field->i64_f.offset = offset;
+            p_field->i64_f.bit    = bit;
+            break;
+
+        case S64:
+            p_field->s64_f.offset = offset;
+            p_field->s64_f.bit    = bit;
+            break;
+
+        case FLOAT:
+            p_field->float_f.offset = offset;
+            break;
+
+        case DOUBLE:
+            p_field->double_f.offset = offset;
+            break;
+
+        default:
+            abort();
+    }
+}
+
+static void Generate(Case_T * p_case, Input_T * p_input) {
+    memset(p_case, 0, sizeof(*p_case));
+
+    size_t no_fields = 1 + Next(p_input) % MAX_FIELDS;
+
+    while(p_case->no_fields < no_fields) {
+        BitField_T * p_field = &p_case->fields[p_case->no_fields];
+        uint8_t      kind    = Next(p_input) % 16;
+
+        if(kind < 9) {
+            BitFieldType_T type = (BitFieldType_T) (Next(p_input) % (S64 + 1));
+            size_t         size = (size_t) 1 << (type / 3);
+            size_t         bit  = Next(p_input) & 1 ? size * BITS_IN_BYTE : 1 + Next(p_input) % (size * BITS_IN_BYTE);
+
+            SetValueField(p_field, type, Allocate(p_case, size), bit);
+            p_field->order = GenerateOrder(p_input, bit);
+        }
+        else if(kind < 11) {
+            BitFieldType_T type = kind == 9 ? FLOAT : DOUBLE;
+            size_t         size = kind == 9 ? sizeof(float) : sizeof(double);
+
+            SetValueField(p_field, type, Allocate(p_case, size), size * BITS_IN_BYTE);
+            p_field->order = GenerateOrder(p_input, size * BITS_IN_BYTE);
+        }
+        else if(kind == 11 && p_case->no_fields + 2 <= no_fields) {
+            p_field[0].field_type   = LEN;
+            p_field[0].len_f.offset = Allocate(p_case, sizeof(size_t));
+            p_field[0].len_f.bit    = 1 + Next(p_input) % MAX_LEN_BIT;
+
+            p_field[1].field_type                  = ARRAY_VARIABLE;
+            p_field[1].array_variable_f.offset     = Allocate(p_case, sizeof(uint8_t *));
+            p_field[1].array_variable_f.len_offset = p_field[0].len_f.offset;
+            p_case->no_fields++;
+        }
+        else if(kind == 12) {
+            p_field->field_type           = ARRAY_FIXED;
+            p_field->array_fixed_f.offset = Allocate(p_case, sizeof(uint8_t *));
+            p_field->array_fixed_f.len    = 1 + Next(p_input) % MAX_ARRAY;
+        }
+        else if(kind == 13) {
+            p_field->field_type = ALIGN;
+        }
+        else {
+            p_field->field_type = PAD;
+            p_field->pad_f.bit  = 1 + Next(p_input) % (2 * BITS_IN_BYTE);
+        }
+
+        p_case->no_fields++;
+    }
+}
+
+static void Fill(const Case_T * p_case, Record_T * p_record, Input_T * p_input) {
+    for(size_t i = 0; i < sizeof(p_record->arrays); i++)
+        p_record->arrays[i / MAX_ARRAY][i % MAX_ARRAY] = Next(p_input);
+
+    for(size_t i = 0; i < p_case->no_fields; i++) {
+        const BitField_T * p_field = &p_case->fields[i];
+
+        switch(p_field->field_type) {
+            case LEN: {
+                size_t len = (Next(p_input) % (MAX_ARRAY + 1)) & ((1u << p_field->len_f.bit) - 1);
+                memcpy(p_record->data + p_field->len_f.offset, &len, sizeof(len));
+                break;
+            }
+
+            case ARRAY_FIXED:
+            case ARRAY_VARIABLE:
+            case ALIGN:
+            case PAD:
+                break;
+
+            default:
+                for(size_t j = 0; j < BitParser_GetValueSize(p_field); j++)
+                    p_record->data[BitParser_GetFieldOffset(p_field) + j] = Next(p_input);
+                break;
+        }
+    }
+}
+
+static void Bind(const Case_T * p_case, Record_T * p_record) {
+    memset(p_record->data, 0, sizeof(p_record->data));
+
+    for(size_t i = 0; i < p_case->no_fields; i++) {
+        const BitField_T * p_field = &p_case->fields[i];
+        uint8_t *          p_array = p_record->arrays[i];
+
+        if(p_field->field_type == ARRAY_FIXED || p_field->field_type == ARRAY_VARIABLE)
+            memcpy(p_record->data + BitParser_GetFieldOffset(p_field), &p_array, sizeof(p_array));
+    }
+}
+
+static Status_T ReferenceSerialize(const Case_T * p_case, uint8_t * data, Stream_T * p_stream, size_t * p_offsets) {
+    for(size_t i = 0; i < p_case->no_fields; i++) {
+        if(p_offsets != NULL)
+            p_offsets[i] = Stream_TellBit(p_stream);
+
+        Status_T result = BitParser_SerializeField(&p_case->fields[i], data, p_stream);
+        if(result != STATUS_SUCCESS)
+            return result;
+    }
+
+    if(p_offsets != NULL)
+        p_offsets[p_case->no_fields] = Stream_TellBit(p_stream);
+
+    return STATUS_SUCCESS;
+}
+
+static Status_T ReferenceDeserialize(const Case_T * p_case, uint8_t * data, Stream_T * p_stream) {
+    for(size_t i = 0; i < p_case->no_fields; i++) {
+        Status_T result = BitParser_DeserializeField(&p_case->fields[i], data, p_stream);
+        if(result != STATUS_SUCCESS)
+            return result;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static bool Equal(const Case_T * p_case, uint8_t * a, uint8_t * b) {
+    for(size_t i = 0; i < p_case->no_fields; i++) {
+        const BitField_T * p_field = &p_case->fields[i];
+        size_t             len;
+        uint8_t *          p_a;
+        uint8_t *          p_b;
+
+        switch(p_field->field_type) {
+            case ALIGN:
+            case PAD:
+                break;
+
+            case ARRAY_FIXED:
+            case ARRAY_VARIABLE:
+                len = p_field->field_type == ARRAY_FIXED ? p_field->array_fixed_f.len
+                                                         : *(size_t *) (a + p_field->array_variable_f.len_offset);
+                memcpy(&p_a, a + BitParser_GetFieldOffset(p_field), sizeof(p_a));
+                memcpy(&p_b, b + BitParser_GetFieldOffset(p_field), sizeof(p_b));
+                if(len != 0 && memcmp(p_a, p_b, len) != 0)
+                    return false;
+                break;
+
+            default:
+                if(memcmp(a + BitParser_GetFieldOffset(p_field), b + BitParser_GetFieldOffset(p_field),
+                          BitParser_GetValueSize(p_field)) != 0)
+                    return false;
+                break;
+        }
+    }
+
+    return true;
+}
+
+static bool HasNan(const Case_T * p_case, const uint8_t * data) {
+    for(size_t i = 0; i < p_case->no_fields; i++) {
+        const BitField_T * p_field = &p_case->fields[i];
+        float              f;
+        double             d;
+
+        switch(p_field->field_type) {
+            case FLOAT:
+                memcpy(&f, data + BitParser_GetFieldOffset(p_field), sizeof(f));
+                if(isnan(f))
+                    return true;
+                break;
+
+            case DOUBLE:
+                memcpy(&d, data + BitParser_GetFieldOffset(p_field), sizeof(d));
+                if(isnan(d))
+                    return true;
+                break;
+
+            default:
+                break;
+        }
+    }
+
+    return false;
+}
+
+static void Check(const Case_T * p_case, Record_T * p_message, Stream_Mode_T mode, Input_T * p_input) {
+    const BitField_T * p_fields  = p_case->fields;
+    size_t             no_fields = p_case->no_fields;
+
+    static uint8_t  reference[BUFFER_SIZE];
+    static uint8_t  output[BUFFER_SIZE];
+    static uint8_t  arena_buffer[BUFFER_SIZE];
+    static Record_T expected;
+    static Record_T actual;
+
+    size_t   offsets[MAX_FIELDS + 1];
+    size_t   work_offsets[MAX_FIELDS + 1];
+    Stream_T stream;
+    Stream_T target;
+
+    /* Reference serialization. */
+    memset(reference, 0, sizeof(reference));
+    Stream_Init(&stream, reference, sizeof(reference), mode);
+    CHECK(ReferenceSerialize(p_case, p_message->data, &stream, offsets) == STATUS_SUCCESS);
+
+    size_t bit_len = offsets[no_fields];
+    size_t len     = (bit_len + BITS_IN_BYTE - 1) / BITS_IN_BYTE;
+    size_t size    = len != 0 ? len : 1;
+
+    /* Length calculation and length profile. */
+    BitLengthProfile_T profile;
+    BitLengthTerm_T    terms[MAX_FIELDS];
+
+    CHECK(BitParser_GetLengthBit(p_fields, no_fields, p_message->data) == bit_len);
+    CHECK(BitParser_InitLengthProfile(&profile, p_fields, no_fields, terms, ARRAY_LEN(terms)) == STATUS_SUCCESS);
+    CHECK(BitParser_GetProfileLengthBit(&profile, p_message->data) == bit_len);
+
+    /* Serialization with native runs, into a buffer of exact length. */
+    memset(output, 0, sizeof(output));
+    Stream_Init(&stream, output, size, mode);
+    CHECK(BitParser_Serialize(p_fields, no_fields, p_message->data, &stream) == STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&stream) == bit_len);
+    CHECK(memcmp(output, reference, size) == 0);
+
+    /* Nested and flattened descriptors. */
+    BitField_T outer = {.field_type = SUBMSG, .submsg_f = {.offset = 0, .p_fields = p_fields, .no_fields = no_fields}};
+    BitField_T flat[MAX_FIELDS];
+    size_t     no_flat;
+
+    memset(output, 0, sizeof(output));
+    Stream_Init(&stream, output, size, mode);
+    CHECK(BitParser_Serialize(&outer, 1, p_message->data, &stream) == STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&stream) == bit_len);
+    CHECK(memcmp(output, reference, size) == 0);
+
+    CHECK(BitParser_Flatten(&outer, 1, flat, ARRAY_LEN(flat), &no_flat) == STATUS_SUCCESS);
+    CHECK(no_flat == no_fields);
+    memset(output, 0, sizeof(output));
+    Stream_Init(&stream, output, size, mode);
+    CHECK(BitParser_Serialize(flat, no_flat, p_message->data, &stream) == STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&stream) == bit_len);
+    CHECK(memcmp(output, reference, size) == 0);
+
+    /* Atomic serialization into a truncated stream, position and its byte are restored. */
+    size_t truncated = len > 1 ? 1 + Next(p_input) % (len - 1) : 0;
+    if(truncated != 0) {
+        Stream_Init(&stream, output, truncated, mode);
+        Status_T reference_result = ReferenceSerialize(p_case, p_message->data, &stream, NULL);
+
+        memset(output, 0, sizeof(output));
+        Stream_Init(&stream, output, truncated, mode);
+        CHECK(BitParser_Serialize(p_fields, no_fields, p_message->data, &stream) == reference_result);
+        CHECK(Stream_TellBit(&stream) == 0);
+        CHECK(output[0] == 0);
+    }
+
+    /* Reference deserialization. */
+    Bind(p_case, &expected);
+    Stream_Init(&stream, reference, size, mode);
+    CHECK(ReferenceDeserialize(p_case, expected.data, &stream) == STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&stream) == bit_len);
+
+    /* Deserialization with native runs. */
+    Bind(p_case, &actual);
+    Stream_Init(&stream, reference, size, mode);
+    CHECK(BitParser_Deserialize(p_fields, no_fields, actual.data, &stream) == STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&stream) == bit_len);
+    CHECK(Equal(p_case, expected.data, actual.data));
+
+    /* Deserialization of a truncated stream fails without moving it. */
+    if(truncated != 0) {
+        Bind(p_case, &actual);
+        Stream_Init(&stream, reference, truncated, mode);
+        Status_T reference_result = ReferenceDeserialize(p_case, actual.data, &stream);
+
+        BitError_T error;
+        Bind(p_case, &actual);
+        Stream_Init(&stream, reference, truncated, mode);
+        CHECK(BitParser_DeserializeEx(p_fields, no_fields, actual.data, &stream, &error) == reference_result);
+        CHECK(error.status == reference_result);
+        CHECK(error.field_index < no_fields);
+        CHECK(Stream_TellBit(&stream) == 0);
+    }
+
+    /* Selected deserialization with every field selected. */
+    uint8_t mask[BIT_PARSER_MASK_SIZE(MAX_FIELDS)];
+    memset(mask, 0xFF, sizeof(mask));
+
+    Bind(p_case, &actual);
+    Stream_Init(&stream, reference, size, mode);
+    CHECK(BitParser_DeserializeSelected(p_fields, no_fields, mask, actual.data, &stream) == STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&stream) == bit_len);
+    CHECK(Equal(p_case, expected.data, actual.data));
+
+    /* Arena deserialization. */
+    BitArena_T arena;
+    BitArena_Init(&arena, arena_buffer, sizeof(arena_buffer));
+
+    Bind(p_case, &actual);
+    Stream_Init(&stream, reference, size, mode);
+    CHECK(BitParser_DeserializeArena(p_fields, no_fields, actual.data, &stream, &arena) == STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&stream) == bit_len);
+    CHECK(Equal(p_case, expected.data, actual.data));
+
+    /* Lazy view, fields requested backwards. */
+    BitView_T view;
+    uint8_t   decoded[BIT_VIEW_DECODED_SIZE(MAX_FIELDS)];
+
+    Bind(p_case, &actual);
+    Stream_Init(&stream, reference, size, mode);
+    BitView_Init(&view, p_fields, no_fields, actual.data, &stream, work_offsets, decoded);
+    for(size_t i = no_fields; i-- > 0;)
+        CHECK(BitView_Get(&view, i) == STATUS_SUCCESS);
+    for(size_t i = 0; i <= no_fields; i++) {
+        size_t bit;
+        CHECK(BitView_GetOffsetBit(&view, i, &bit) == STATUS_SUCCESS);
+        CHECK(bit == offsets[i]);
+    }
+    CHECK(Equal(p_case, expected.data, actual.data));
+
+    /* Serialization of decoded message. It is not compared with the original one, because negative zero
+     * of sign and magnitude fields decodes to zero. */
+    static uint8_t decoded_reference[BUFFER_SIZE];
+
+    memset(decoded_reference, 0, sizeof(decoded_reference));
+    Stream_Init(&stream, decoded_reference, size, mode);
+    CHECK(ReferenceSerialize(p_case, expected.data, &stream, NULL) == STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&stream) == bit_len);
+
+    memset(output, 0, sizeof(output));
+    Stream_Init(&stream, output, size, mode);
+    CHECK(BitParser_Serialize(p_fields, no_fields, expected.data, &stream) == STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&stream) == bit_len);
+    CHECK(memcmp(output, decoded_reference, size) == 0);
+
+    /* Identity transcoding, values pass through decoded form as well. Floating point values are converted
+     * through double, which quiets signaling NaN, so messages with NaN are only checked for length. */
+    size_t map[MAX_FIELDS];
+    for(size_t i = 0; i < no_fields; i++)
+        map[i] = i;
+
+    memset(output, 0, sizeof(output));
+    Stream_Init(&stream, reference, size, mode);
+    Stream_Init(&target, output, size, mode);
+    CHECK(BitTranscode_Message(p_fields, no_fields, &stream, p_fields, no_fields, &target, map, work_offsets) ==
+          STATUS_SUCCESS);
+    CHECK(Stream_TellBit(&target) == bit_len);
+    CHECK(HasNan(p_case, expected.data) || memcmp(output, decoded_reference, size) == 0);
+
+    /* Compiled filters on raw field bits read with Stream. */
+    for(size_t i = 0; i < no_fields; i++) {
+        const BitField_T * p_field = &p_fields[i];
+
+        if(p_field->field_type == ARRAY_VARIABLE)
+            break;
+        if(p_field->field_type > S64 || p_field->order != BIT_ORDER_STREAM)
+            continue;
+
+        size_t   width = BitParser_GetFieldLengthBit(p_field, NULL, 0);
+        uint64_t raw;
+
+        Stream_Init(&stream, reference, size, mode);
+        CHECK(Stream_SeekBit(&stream, offsets[i]) == STATUS_SUCCESS);
+        CHECK(U64_DeserializeBit(&raw, width, &stream) == STATUS_SUCCESS);
+
+        BitPredicate_T  predicate = {.field = i, .op = BIT_PREDICATE_EQ, .a = raw};
+        BitFilterTerm_T term;
+        BitFilter_T     filter;
+
+        CHECK(BitFilter_Compile(&filter, p_fields, no_fields, &predicate, 1, BIT_FILTER_AND, mode, &term) ==
+              STATUS_SUCCESS);
+        CHECK(BitFilter_Match(&filter, reference, size));
+
+        term.a ^= 1;
+        CHECK(!BitFilter_Match(&filter, reference, size));
+    }
+
+    /* Patch of a single value field. */
+    size_t             index   = Next(p_input) % no_fields;
+    const BitField_T * p_field = &p_fields[index];
+
+    if(p_field->field_type <= DOUBLE) {
+        BitPatch_T patch;
+
+        memcpy(actual.data, p_message->data, sizeof(actual.data));
+        for(size_t i = 0; i < BitParser_GetValueSize(p_field); i++)
+            actual.data[BitParser_GetFieldOffset(p_field) + i] = Next(p_input);
+
+        memcpy(output, reference, size);
+        Stream_Init(&stream, output, size, mode);
+        BitPatch_Init(&patch, p_fields, no_fields, &stream, work_offsets);
+        CHECK(BitPatch_Field(&patch, index, actual.data) == STATUS_SUCCESS);
+
+        static uint8_t patched[BUFFER_SIZE];
+        memset(patched, 0, sizeof(patched));
+        Stream_Init(&stream, patched, size, mode);
+        CHECK(ReferenceSerialize(p_case, actual.data, &stream, NULL) == STATUS_SUCCESS);
+        CHECK(memcmp(output, patched, size) == 0);
+    }
+}
@@ -32,84 +32,84 @@ typedef struct {
     uint16_t starting_address;
     uint16_t no_points;
 } modbus_read_coil_status_query_t;
-extern const BitField_T modbus_read_coil_status_query_desc[];
+extern const BitField_T modbus_read_coil_status_query_desc[2];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_read_coil_status_response_t;
-extern const BitField_T modbus_read_coil_status_response_desc[];
+extern const BitField_T modbus_read_coil_status_response_desc[2];
 
 typedef struct {
     uint16_t starting_address;
     uint16_t no_points;
 } modbus_read_input_status_query_t;
-extern const BitField_T modbus_read_input_status_query_desc[];
+extern const BitField_T modbus_read_input_status_query_desc[2];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_read_input_status_response_t;
-extern const BitField_T modbus_read_input_status_response_desc[];
+extern const BitField_T modbus_read_input_status_response_desc[2];
 
 typedef struct {
     uint16_t starting_address;
     uint16_t no_points;
 } modbus_read_holding_registers_query_t;
-extern const BitField_T modbus_read_holding_registers_query_desc[];
+extern const BitField_T modbus_read_holding_registers_query_desc[2];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_read_holding_registers_response_t;
-extern const BitField_T modbus_read_holding_registers_response_desc[];
+extern const BitField_T modbus_read_holding_registers_response_desc[2];
 
 typedef struct {
     uint16_t starting_address;
     uint16_t no_points;
 } modbus_read_input_registers_query_t;
-extern const BitField_T modbus_read_input_registers_query_desc[];
+extern const BitField_T modbus_read_input_registers_query_desc[2];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_read_input_registers_response_t;
-extern const BitField_T modbus_read_input_registers_response_desc[];
+extern const BitField_T modbus_read_input_registers_response_desc[2];
 
 typedef struct {
     uint16_t coil_address;
     uint16_t coil_data;
 } modbus_force_single_coil_query_t;
-extern const BitField_T modbus_force_single_coil_query_desc[];
+extern const BitField_T modbus_force_single_coil_query_desc[2];
 
 typedef struct {
     uint16_t coil_address;
     uint16_t coil_data;
 } modbus_force_single_coil_response_t;
-extern const BitField_T modbus_force_single_coil_response_desc[];
+extern const BitField_T modbus_force_single_coil_response_desc[2];
 
 typedef struct {
     uint16_t register_address;
     uint16_t preset_data;
 } modbus_preset_single_register_query_t;
-extern const BitField_T modbus_preset_single_register_query_desc[];
+extern const BitField_T modbus_preset_single_register_query_desc[2];
 
 typedef struct {
     uint16_t register_address;
     uint16_t preset_data;
 } modbus_preset_single_register_response_t;
-extern const BitField_T modbus_preset_single_register_response_desc[];
+extern const BitField_T modbus_preset_single_register_response_desc[2];
 
 typedef struct {
     uint8_t coil_data;
 } modbus_read_exception_status_response_t;
-extern const BitField_T modbus_read_exception_status_response_desc[];
+extern const BitField_T modbus_read_exception_status_response_desc[1];
 
 typedef struct {
     uint16_t status;
     uint16_t event_count;
 } modbus_fetch_comm_event_ctr_response_t;
-extern const BitField_T modbus_fetch_comm_event_ctr_response_desc[];
+extern const BitField_T modbus_fetch_comm_event_ctr_response_desc[2];
 
 typedef struct {
     size_t len;
@@ -118,7 +118,7 @@ typedef struct {
     uint16_t message_count;
     uint8_t * events;
 } modbus_fetch_comm_event_log_response_t;
-extern const BitField_T modbus_fetch_comm_event_log_response_desc[];
+extern const BitField_T modbus_fetch_comm_event_log_response_desc[5];
 
 typedef struct {
     uint16_t coil_address;
@@ -126,13 +126,13 @@ typedef struct {
     size_t len;
     uint8_t * force_data;
 } modbus_force_multiple_coils_query_t;
-extern const BitField_T modbus_force_multiple_coils_query_desc[];
+extern const BitField_T modbus_force_multiple_coils_query_desc[4];
 
 typedef struct {
     uint16_t coil_address;
     uint16_t quantity_of_coils;
 } modbus_force_multiple_coils_response_t;
-extern const BitField_T modbus_force_multiple_coils_response_desc[];
+extern const BitField_T modbus_force_multiple_coils_response_desc[2];
 
 typedef struct {
     uint16_t starting_address;
@@ -140,13 +140,13 @@ typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_preset_multiple_regs_query_t;
-extern const BitField_T modbus_preset_multiple_regs_query_desc[];
+extern const BitField_T modbus_preset_multiple_regs_query_desc[4];
 
 typedef struct {
     uint16_t starting_address;
     uint16_t no_registers;
 } modbus_preset_multiple_regs_response_t;
-extern const BitField_T modbus_preset_multiple_regs_response_desc[];
+extern const BitField_T modbus_preset_multiple_regs_response_desc[2];
 
 typedef struct {
     size_t len;
@@ -154,45 +154,45 @@ typedef struct {
     uint8_t run_indicator_status;
     uint8_t * additional_data;
 } modbus_report_slave_id_response_t;
-extern const BitField_T modbus_report_slave_id_response_desc[];
+extern const BitField_T modbus_report_slave_id_response_desc[4];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_read_general_reference_query_t;
-extern const BitField_T modbus_read_general_reference_query_desc[];
+extern const BitField_T modbus_read_general_reference_query_desc[2];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_read_general_reference_response_t;
-extern const BitField_T modbus_read_general_reference_response_desc[];
+extern const BitField_T modbus_read_general_reference_response_desc[2];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_write_general_reference_query_t;
-extern const BitField_T modbus_write_general_reference_query_desc[];
+extern const BitField_T modbus_write_general_reference_query_desc[2];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_write_general_reference_response_t;
-extern const BitField_T modbus_write_general_reference_response_desc[];
+extern const BitField_T modbus_write_general_reference_response_desc[2];
 
 typedef struct {
     uint16_t reference_address;
     uint16_t and_mask;
     uint16_t or_mask;
 } modbus_mask_write_4x_register_query_t;
-extern const BitField_T modbus_mask_write_4x_register_query_desc[];
+extern const BitField_T modbus_mask_write_4x_register_query_desc[3];
 
 typedef struct {
     uint16_t reference_address;
     uint16_t and_mask;
     uint16_t or_mask;
 } modbus_mask_write_4x_register_response_t;
-extern const BitField_T modbus_mask_write_4x_register_response_desc[];
+extern const BitField_T modbus_mask_write_4x_register_response_desc[3];
 
 typedef struct {
     uint16_t read_reference_address;
@@ -202,23 +202,23 @@ typedef struct {
     size_t len;
     uint8_t * write_data;
 } modbus_read_write_4x_registers_query_t;
-extern const BitField_T modbus_read_write_4x_registers_query_desc[];
+extern const BitField_T modbus_read_write_4x_registers_query_desc[6];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_read_write_4x_registers_response_t;
-extern const BitField_T modbus_read_write_4x_registers_response_desc[];
+extern const BitField_T modbus_read_write_4x_registers_response_desc[2];
 
 typedef struct {
     uint16_t fifo_pointer_address;
 } modbus_read_fifo_queue_query_t;
-extern const BitField_T modbus_read_fifo_queue_query_desc[];
+extern const BitField_T modbus_read_fifo_queue_query_desc[1];
 
 typedef struct {
     size_t len;
     uint8_t * data;
 } modbus_read_fifo_queue_response_t;
-extern const BitField_T modbus_read_fifo_queue_response_desc[];
+extern const BitField_T modbus_read_fifo_queue_response_desc[2];
 
 #endif //BITPARSER_MODBUS_H
@@ -0,0 +1,71 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include "BitArena.h"
+#include "BitParserError.h"
+
+void BitArena_Init(BitArena_T * p_self, uint8_t * p_buffer, size_t size) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_buffer != NULL || size == 0);
+
+    p_self->p_buffer = p_buffer;
+    p_self->size     = size;
+    p_self->used     = 0;
+}
+
+void * BitArena_Alloc(BitArena_T * p_self, size_t size, size_t align) {
+    ASSERT(p_self != NULL);
+    ASSERT(align != 0 && (align & (align - 1)) == 0);
+
+    uintptr_t address = (uintptr_t) (p_self->p_buffer + p_self->used);
+    size_t    padding = (align - address % align) % align;
+
+    if(padding > p_self->size - p_self->used || size > p_self->size - p_self->used - padding)
+        return NULL;
+
+    void * p_memory = p_self->p_buffer + p_self->used + padding;
+    p_self->used += padding + size;
+
+    return p_memory;
+}
+
+void BitArena_Reset(BitArena_T * p_self) {
+    ASSERT(p_self != NULL);
+
+    p_self->used = 0;
+}
+
+size_t BitArena_GetUsed(const BitArena_T * p_self) {
+    ASSERT(p_self != NULL);
+
+    return p_self->used;
+}
+
+void BitArena_Rewind(BitArena_T * p_self, size_t used) {
+    ASSERT(p_self != NULL);
+    ASSERT(used <= p_self->used);
+
+    p_self->used = used;
+}
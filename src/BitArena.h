@@ -0,0 +1,94 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_ARENA_H
+#define BIT_ARENA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+/**
+ * Bump allocator over caller provided buffer.
+ *
+ * Memory is carved from the buffer in order and is never freed one by one, the whole arena is released
+ * at once with BitArena_Reset, eg. after a batch of messages is processed.
+ */
+typedef struct {
+    uint8_t * p_buffer;     /*!< Arena memory. */
+    size_t    size;         /*!< Size of arena memory in bytes. */
+    size_t    used;         /*!< Number of bytes already allocated, including alignment padding. */
+} BitArena_T;
+
+/**
+ * Initialize arena.
+ *
+ * @param p_self        Pointer to allocated arena object.
+ * @param p_buffer      Arena memory.
+ * @param size          Size of arena memory in bytes.
+ */
+void BitArena_Init(BitArena_T * p_self, uint8_t * p_buffer, size_t size);
+
+/**
+ * Allocate memory from arena.
+ *
+ * @param p_self        Pointer to arena object.
+ * @param size          Size of memory in bytes.
+ * @param align         Alignment of memory, power of two.
+ * @return              Pointer to allocated memory or NULL if arena is exhausted.
+ */
+void * BitArena_Alloc(BitArena_T * p_self, size_t size, size_t align);
+
+/**
+ * Release all memory allocated from arena.
+ *
+ * @param p_self        Pointer to arena object.
+ */
+void BitArena_Reset(BitArena_T * p_self);
+
+/**
+ * Get number of bytes allocated from arena, to be given to BitArena_Rewind.
+ *
+ * @param p_self        Pointer to arena object.
+ * @return              Number of allocated bytes.
+ */
+size_t BitArena_GetUsed(const BitArena_T * p_self);
+
+/**
+ * Release memory allocated after arena had given number of bytes allocated.
+ *
+ * @param p_self        Pointer to arena object.
+ * @param used          Number of allocated bytes returned by BitArena_GetUsed.
+ */
+void BitArena_Rewind(BitArena_T * p_self, size_t used);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //BIT_ARENA_H
@@ -0,0 +1,176 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "BitDelta.h"
+#include "UParser.h"
+#include "BitParserError.h"
+
+/**
+ * Check if field can be a part of delta.
+ *
+ * @param p_field   Bit field description.
+ * @return          True for supported value fields.
+ */
+static bool IsDeltaField(const BitField_T * p_field);
+
+/**
+ * Check if field value differs between two message structs.
+ *
+ * @param p_fields  Bit field message descriptor.
+ * @param index     Index of field.
+ * @param data      Current message struct.
+ * @param p_other   Previous message struct.
+ * @return          True if field changed.
+ */
+static bool IsChanged(const BitField_T * p_fields, size_t index, void * data, void * p_other);
+
+Status_T BitDelta_Serialize(const BitField_T * p_fields, size_t no_fields, void * data, void * p_previous,
+                            Stream_T * p_stream) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_previous != NULL);
+    ASSERT(p_stream != NULL);
+
+    for(size_t i = 0; i < no_fields; i++) {
+        bool delta_field = IsDeltaField(&p_fields[i]);
+        if(!delta_field && p_fields[i].field_type != ALIGN && p_fields[i].field_type != PAD)
+            return ERROR_DESCRIPTOR_INVALID;
+
+        uint8_t  present = delta_field && IsChanged(p_fields, i, data, p_previous) ? 1 : 0;
+        Status_T result  = U8_SerializeBit(&present, 1, p_stream);
+        if(result != STATUS_SUCCESS)
+            return result;
+    }
+
+    for(size_t i = 0; i < no_fields; i++) {
+        if(!IsDeltaField(&p_fields[i]) || !IsChanged(p_fields, i, data, p_previous))
+            continue;
+
+        Status_T result = BitParser_SerializeField(&p_fields[i], data, p_stream);
+        if(result != STATUS_SUCCESS)
+            return result;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+Status_T BitDelta_Deserialize(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+
+    Stream_T bitmap = *p_stream;
+    Status_T result = Stream_SeekBit(p_stream, Stream_TellBit(p_stream) + no_fields);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    for(size_t i = 0; i < no_fields; i++) {
+        uint8_t present;
+        result = U8_DeserializeBit(&present, 1, &bitmap);
+        if(result != STATUS_SUCCESS)
+            return result;
+
+        if(!IsDeltaField(&p_fields[i])) {
+            if(p_fields[i].field_type != ALIGN && p_fields[i].field_type != PAD)
+                return ERROR_DESCRIPTOR_INVALID;
+
+            continue;
+        }
+
+        if(present == 0)
+            continue;
+
+        result = BitParser_DeserializeField(&p_fields[i], data, p_stream);
+        if(result != STATUS_SUCCESS)
+            return result;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static bool IsDeltaField(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    switch(p_field->field_type) {
+        case U8:
+        case I8:
+        case S8:
+        case U16:
+        case I16:
+        case S16:
+        case U32:
+        case I32:
+        case S32:
+        case U64:
+        case I64:
+        case S64:
+        case FLOAT:
+        case DOUBLE:
+        case LEN:
+        case ARRAY_FIXED:
+        case ARRAY_VARIABLE:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static bool IsChanged(const BitField_T * p_fields, size_t index, void * data, void * p_other) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_other != NULL);
+
+    const BitField_T * p_field = &p_fields[index];
+
+    switch(p_field->field_type) {
+        case ARRAY_FIXED: {
+            uint8_t * p_array       = *(uint8_t**)(data + p_field->array_fixed_f.offset);
+            uint8_t * p_other_array = *(uint8_t**)(p_other + p_field->array_fixed_f.offset);
+
+            return memcmp(p_array, p_other_array, p_field->array_fixed_f.len) != 0;
+        }
+
+        case ARRAY_VARIABLE: {
+            size_t    len           = *(size_t*)(data + p_field->array_variable_f.len_offset);
+            size_t    other_len     = *(size_t*)(p_other + p_field->array_variable_f.len_offset);
+            uint8_t * p_array       = *(uint8_t**)(data + p_field->array_variable_f.offset);
+            uint8_t * p_other_array = *(uint8_t**)(p_other + p_field->array_variable_f.offset);
+
+            return len != other_len || (len != 0 && memcmp(p_array, p_other_array, len) != 0);
+        }
+
+        default: {
+            size_t offset = BitParser_GetFieldOffset(p_field);
+            return memcmp(data + offset, p_other + offset, BitParser_GetValueSize(p_field)) != 0;
+        }
+    }
+}
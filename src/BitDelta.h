@@ -0,0 +1,74 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_DELTA_H
+#define BIT_DELTA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+/**
+ * Serialize delta of a message against its previous snapshot.
+ *
+ * Delta starts with presence bitmap, one bit per descriptor field in descriptor order, set for fields whose
+ * value differs from the snapshot. Changed fields follow, serialized as by BitParser_Serialize. Arrays are
+ * compared by content, ARRAY_VARIABLE is also changed if its length changed. ALIGN and PAD fields are not
+ * part of delta, their bits are always clear. Supported fields are integer, FLOAT, DOUBLE, LEN, ARRAY_FIXED,
+ * ARRAY_VARIABLE, ALIGN and PAD.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Current message struct.
+ * @param p_previous    Previous message struct, known to the receiver.
+ * @param p_stream      Stream to write data.
+ * @return              Status. ERROR_DESCRIPTOR_INVALID if descriptor has unsupported fields.
+ */
+Status_T BitDelta_Serialize(const BitField_T * p_fields, size_t no_fields, void * data, void * p_previous,
+                            Stream_T * p_stream);
+
+/**
+ * Deserialize delta and apply it to a base message struct, ie. overwrite changed fields only.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Base message struct, updated in place.
+ * @param p_stream      Stream to read data.
+ * @return              Status. ERROR_DESCRIPTOR_INVALID if descriptor has unsupported fields.
+ */
+Status_T BitDelta_Deserialize(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //BIT_DELTA_H
@@ -0,0 +1,242 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include "BitFilter.h"
+#include "BitParserError.h"
+
+#define WINDOW_BITS (sizeof(uint64_t) * BITS_IN_BYTE)
+
+/**
+ * Extract raw field bits described by a compiled predicate from a record.
+ *
+ * @param p_term    Compiled predicate.
+ * @param p_record  Pointer to the first byte of record.
+ * @param mode      Stream mode of record.
+ * @return          Field value.
+ */
+static uint64_t Extract(const BitFilterTerm_T * p_term, const uint8_t * p_record, Stream_Mode_T mode);
+
+/**
+ * Evaluate compiled predicate on a record.
+ *
+ * @param p_term    Compiled predicate.
+ * @param p_record  Pointer to the first byte of record.
+ * @param mode      Stream mode of record.
+ * @return          Predicate result.
+ */
+static bool Evaluate(const BitFilterTerm_T * p_term, const uint8_t * p_record, Stream_Mode_T mode);
+
+Status_T BitFilter_Compile(BitFilter_T * p_self, const BitField_T * p_fields, size_t no_fields,
+                           const BitPredicate_T * p_predicates, size_t no_predicates, BitFilterLogic_T logic,
+                           Stream_Mode_T mode, BitFilterTerm_T * p_terms) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_fields != NULL);
+    ASSERT(p_predicates != NULL);
+    ASSERT(p_terms != NULL);
+    ASSERT(logic == BIT_FILTER_AND || logic == BIT_FILTER_OR);
+    ASSERT(STREAM_MODE_ENABLED(mode));
+
+    p_self->p_terms     = p_terms;
+    p_self->no_terms    = no_predicates;
+    p_self->logic       = logic;
+    p_self->mode        = mode;
+    p_self->min_bit_len = 0;
+
+    for(size_t i = 0; i < no_predicates; i++) {
+        const BitPredicate_T * p_predicate = &p_predicates[i];
+        ASSERT(p_predicate->field < no_fields);
+
+        size_t bit = 0;
+        for(size_t j = 0; j <= p_predicate->field; j++) {
+            switch(p_fields[j].field_type) {
+                case ARRAY_VARIABLE:
+                case ARRAY_VARIABLE_WHOLE_MSG:
+                case SUBMSG:
+                case UNION:
+                case REPEATED:
+                    return ERROR_DESCRIPTOR_INVALID;
+
+                default:
+                    break;
+            }
+
+            if(j < p_predicate->field)
+                bit += BitParser_GetFieldLengthBit(&p_fields[j], NULL, bit);
+        }
+
+        const BitField_T * p_field = &p_fields[p_predicate->field];
+        if(p_field->order != BIT_ORDER_STREAM)
+            return ERROR_DESCRIPTOR_INVALID;
+
+        switch(p_field->field_type) {
+            case ARRAY_FIXED:
+            case ALIGN:
+            case PAD:
+                return ERROR_DESCRIPTOR_INVALID;
+
+            default:
+                break;
+        }
+
+        size_t width = BitParser_GetFieldLengthBit(p_field, NULL, bit);
+        if(width == 0 || width > WINDOW_BITS)
+            return ERROR_DESCRIPTOR_INVALID;
+
+        BitFilterTerm_T * p_term = &p_terms[i];
+        p_term->byte     = bit / BITS_IN_BYTE;
+        p_term->no_bytes = (bit % BITS_IN_BYTE + width + BITS_IN_BYTE - 1) / BITS_IN_BYTE;
+        p_term->shift    = STREAM_MODE_IS_LITTLE(mode) ? bit % BITS_IN_BYTE
+                                          : p_term->no_bytes * BITS_IN_BYTE - bit % BITS_IN_BYTE - width;
+        p_term->bit      = bit;
+        p_term->width    = width;
+        p_term->op       = p_predicate->op;
+        p_term->a        = p_predicate->a;
+        p_term->b        = p_predicate->b;
+
+        if(bit + width > p_self->min_bit_len)
+            p_self->min_bit_len = bit + width;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+bool BitFilter_Match(const BitFilter_T * p_self, const uint8_t * p_record, size_t len) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_record != NULL);
+
+    if(len * BITS_IN_BYTE < p_self->min_bit_len)
+        return false;
+
+    for(size_t i = 0; i < p_self->no_terms; i++) {
+        bool result = Evaluate(&p_self->p_terms[i], p_record, p_self->mode);
+
+        if(p_self->logic == BIT_FILTER_AND && !result)
+            return false;
+        if(p_self->logic == BIT_FILTER_OR && result)
+            return true;
+    }
+
+    return p_self->logic == BIT_FILTER_AND;
+}
+
+Status_T BitFilter_Scan(const BitFilter_T * p_self, const BitBatch_T * p_batch, size_t first,
+                        size_t * p_indices, size_t no_indices, size_t * p_no_found) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_batch != NULL);
+    ASSERT(p_batch->mode == p_self->mode);
+    ASSERT(p_indices != NULL);
+    ASSERT(p_no_found != NULL);
+
+    (*p_no_found) = 0;
+
+    if(p_batch->p_index == NULL) {
+        /* Fixed stride records, check bounds once and walk the buffer directly. */
+        if(p_batch->no_records * p_batch->record_len > p_batch->len)
+            return ERROR_STREAM_TOO_SHORT;
+
+        const uint8_t * p_record = p_batch->p_buffer + first * p_batch->record_len;
+        for(size_t i = first; i < p_batch->no_records && (*p_no_found) < no_indices; i++) {
+            if(BitFilter_Match(p_self, p_record, p_batch->record_len))
+                p_indices[(*p_no_found)++] = i;
+
+            p_record += p_batch->record_len;
+        }
+
+        return STATUS_SUCCESS;
+    }
+
+    for(size_t i = first; i < p_batch->no_records && (*p_no_found) < no_indices; i++) {
+        uint8_t * p_record;
+        size_t    len;
+
+        Status_T result = BitParser_GetBatchRecord(p_batch, i, &p_record, &len);
+        if(result != STATUS_SUCCESS)
+            return result;
+
+        if(BitFilter_Match(p_self, p_record, len))
+            p_indices[(*p_no_found)++] = i;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static uint64_t Extract(const BitFilterTerm_T * p_term, const uint8_t * p_record, Stream_Mode_T mode) {
+    ASSERT(p_term != NULL);
+    ASSERT(p_record != NULL);
+
+    const uint8_t * p_bytes   = p_record + p_term->byte;
+    size_t          in_byte   = p_term->bit % BITS_IN_BYTE;
+    size_t          no_window = MIN(p_term->no_bytes, sizeof(uint64_t));
+    uint64_t        window    = 0;
+    uint64_t        mask      = p_term->width == WINDOW_BITS ? UINT64_MAX : ((uint64_t) 1 << p_term->width) - 1;
+
+    if(STREAM_MODE_IS_LITTLE(mode)) {
+        for(size_t i = 0; i < no_window; i++)
+            window |= (uint64_t) p_bytes[i] << (i * BITS_IN_BYTE);
+
+        if(p_term->no_bytes <= sizeof(uint64_t))
+            return (window >> p_term->shift) & mask;
+
+        /* Field spans nine bytes, glue the top bits from the last one. */
+        uint64_t last = p_bytes[sizeof(uint64_t)];
+        return ((window >> in_byte) | (last << (WINDOW_BITS - in_byte))) & mask;
+    }
+    else {
+        for(size_t i = 0; i < no_window; i++)
+            window = (window << BITS_IN_BYTE) | p_bytes[i];
+
+        if(p_term->no_bytes <= sizeof(uint64_t))
+            return (window >> p_term->shift) & mask;
+
+        /* Field spans nine bytes, glue the bottom bits from the last one. */
+        uint64_t last = p_bytes[sizeof(uint64_t)];
+        return ((window << in_byte) | (last >> (BITS_IN_BYTE - in_byte))) >> (WINDOW_BITS - p_term->width);
+    }
+}
+
+static bool Evaluate(const BitFilterTerm_T * p_term, const uint8_t * p_record, Stream_Mode_T mode) {
+    ASSERT(p_term != NULL);
+
+    uint64_t value = Extract(p_term, p_record, mode);
+
+    switch(p_term->op) {
+        case BIT_PREDICATE_EQ:
+            return value == p_term->a;
+
+        case BIT_PREDICATE_RANGE:
+            return value >= p_term->a && value <= p_term->b;
+
+        case BIT_PREDICATE_MASK:
+            return (value & p_term->a) == p_term->b;
+
+        default:
+            ASSERT(false);
+            return false;
+    }
+}
@@ -0,0 +1,144 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_FILTER_H
+#define BIT_FILTER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+/**
+ * Predicate operator.
+ */
+typedef enum {
+    BIT_PREDICATE_EQ,       /*!< Field is equal to a. */
+    BIT_PREDICATE_RANGE,    /*!< Field is in range from a to b, both included. */
+    BIT_PREDICATE_MASK,     /*!< Field bits selected by mask a are equal to b. */
+} BitPredicateOp_T;
+
+/**
+ * Logic combining results of all predicates of a filter.
+ */
+typedef enum {
+    BIT_FILTER_AND,         /*!< Record matches if all predicates are true. */
+    BIT_FILTER_OR,          /*!< Record matches if any predicate is true. */
+} BitFilterLogic_T;
+
+/**
+ * Predicate on a single field of a message. Values are compared with raw, unsigned bits of a field
+ * as they are stored in a stream, so signed and floating point fields are compared by their encoding.
+ */
+typedef struct {
+    size_t           field;     /*!< Index of field in descriptor. */
+    BitPredicateOp_T op;        /*!< Predicate operator. */
+    uint64_t         a;         /*!< First operand. */
+    uint64_t         b;         /*!< Second operand, unused by BIT_PREDICATE_EQ. */
+} BitPredicate_T;
+
+/**
+ * Predicate compiled into a direct bit extraction at known offset from the record start.
+ */
+typedef struct {
+    size_t           byte;      /*!< Index of the first byte holding the field. */
+    size_t           no_bytes;  /*!< Number of bytes holding the field. */
+    size_t           shift;     /*!< Shift of field in a window made of no_bytes bytes. */
+    size_t           bit;       /*!< Field offset in bits. */
+    size_t           width;     /*!< Field width in bits. */
+    BitPredicateOp_T op;        /*!< Predicate operator. */
+    uint64_t         a;         /*!< First operand. */
+    uint64_t         b;         /*!< Second operand. */
+} BitFilterTerm_T;
+
+/**
+ * Compiled filter.
+ */
+typedef struct {
+    BitFilterTerm_T * p_terms;      /*!< Compiled predicates. */
+    size_t            no_terms;     /*!< Number of compiled predicates. */
+    BitFilterLogic_T  logic;        /*!< Logic combining predicates. */
+    Stream_Mode_T     mode;         /*!< Stream mode of records. */
+    size_t            min_bit_len;  /*!< Minimal record length in bits covering all predicate fields. */
+} BitFilter_T;
+
+/**
+ * Compile predicates into a filter.
+ * All fields preceding a predicate field must have fixed length, ie. no variable arrays are allowed before
+ * it, and the predicate field itself must be a value not wider than 64 bits, without byte order override.
+ * Nested descriptors shall be flattened with BitParser_Flatten first. Records are assumed to start at byte
+ * boundary.
+ *
+ * @param p_self            Pointer to allocated filter object.
+ * @param p_fields          Bit field message descriptor.
+ * @param no_fields         Number of fields in descriptor.
+ * @param p_predicates      Predicates to compile.
+ * @param no_predicates     Number of predicates.
+ * @param logic             Logic combining predicates.
+ * @param mode              Stream mode of records.
+ * @param p_terms           Storage for no_predicates compiled predicates.
+ * @return                  Status. ERROR_DESCRIPTOR_INVALID if a predicate cannot be compiled.
+ */
+Status_T BitFilter_Compile(BitFilter_T * p_self, const BitField_T * p_fields, size_t no_fields,
+                           const BitPredicate_T * p_predicates, size_t no_predicates, BitFilterLogic_T logic,
+                           Stream_Mode_T mode, BitFilterTerm_T * p_terms);
+
+/**
+ * Test a record of given length against a filter.
+ *
+ * @param p_self    Pointer to filter object.
+ * @param p_record  Pointer to the first byte of record.
+ * @param len       Record length in bytes.
+ * @return          True if record matches, false if not or if it is too short.
+ */
+bool BitFilter_Match(const BitFilter_T * p_self, const uint8_t * p_record, size_t len);
+
+/**
+ * Find indices of records of a batch matching a filter. Records are never decoded, only predicate fields
+ * are extracted. Scan stops when no_indices indices are found, it can be continued from the next record.
+ *
+ * @param p_self        Pointer to filter object.
+ * @param p_batch       Batch description, p_output is not used.
+ * @param first         Index of the first record to test.
+ * @param p_indices     Output array of matching record indices.
+ * @param no_indices    Size of output array.
+ * @param p_no_found    Output number of matching records found.
+ * @return              Status.
+ */
+Status_T BitFilter_Scan(const BitFilter_T * p_self, const BitBatch_T * p_batch, size_t first,
+                        size_t * p_indices, size_t no_indices, size_t * p_no_found);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //BIT_FILTER_H
@@ -0,0 +1,111 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <pthread.h>
+#include <stdatomic.h>
+
+#include "BitParallel.h"
+#include "BitParserError.h"
+
+/**
+ * State shared by all workers decoding one batch.
+ */
+typedef struct {
+    const BitField_T * p_fields;    /*!< Bit field message descriptor. */
+    size_t             no_fields;   /*!< Number of fields in descriptor. */
+    const BitBatch_T * p_batch;     /*!< Batch description. */
+    size_t             chunk_len;   /*!< Number of records in a chunk. */
+    atomic_size_t      next;        /*!< Index of the first record of the next free chunk. */
+    atomic_uint        status;      /*!< First failure status, STATUS_SUCCESS if none. */
+} Job_T;
+
+/**
+ * Decode chunks of a batch until all of them are taken or any worker fails.
+ *
+ * @param p_arg     Pointer to Job_T.
+ * @return          NULL.
+ */
+static void * Worker(void * p_arg);
+
+Status_T BitParallel_DeserializeBatch(const BitField_T * p_fields, size_t no_fields, const BitBatch_T * p_batch,
+                                      size_t no_threads, size_t chunk_len) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_batch != NULL);
+    ASSERT(no_threads != 0);
+
+    Job_T job = {
+        .p_fields  = p_fields,
+        .no_fields = no_fields,
+        .p_batch   = p_batch,
+        .chunk_len = chunk_len != 0 ? chunk_len : BIT_PARALLEL_DEFAULT_CHUNK,
+    };
+    atomic_init(&job.next, 0);
+    atomic_init(&job.status, STATUS_SUCCESS);
+
+    pthread_t threads[BIT_PARALLEL_MAX_THREADS - 1];
+    size_t no_started = 0;
+
+    no_threads = MIN(no_threads, BIT_PARALLEL_MAX_THREADS);
+
+    for(size_t i = 1; i < no_threads; i++) {
+        if(pthread_create(&threads[no_started], NULL, Worker, &job) != 0)
+            break;
+        no_started++;
+    }
+
+    Worker(&job);
+
+    for(size_t i = 0; i < no_started; i++)
+        pthread_join(threads[i], NULL);
+
+    return atomic_load(&job.status);
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static void * Worker(void * p_arg) {
+    ASSERT(p_arg != NULL);
+
+    Job_T * p_job = p_arg;
+    size_t  no_records = p_job->p_batch->no_records;
+
+    while(atomic_load_explicit(&p_job->status, memory_order_relaxed) == STATUS_SUCCESS) {
+        size_t first = atomic_fetch_add(&p_job->next, p_job->chunk_len);
+        if(first >= no_records)
+            break;
+
+        size_t   count  = MIN(p_job->chunk_len, no_records - first);
+        Status_T result = BitParser_DeserializeBatch(p_job->p_fields, p_job->no_fields, p_job->p_batch, first, count);
+
+        if(result != STATUS_SUCCESS) {
+            unsigned int expected = STATUS_SUCCESS;
+            atomic_compare_exchange_strong(&p_job->status, &expected, result);
+        }
+    }
+
+    return NULL;
+}
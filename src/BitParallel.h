@@ -0,0 +1,69 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_PARALLEL_H
+#define BIT_PARALLEL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stddef.h>
+
+#include "BitParser.h"
+#include "BitParserError.h"
+
+/**
+ * Default number of records taken by a worker at once.
+ */
+#define BIT_PARALLEL_DEFAULT_CHUNK 1024u
+
+/**
+ * Maximum number of threads used for one batch, including calling thread.
+ */
+#define BIT_PARALLEL_MAX_THREADS 64u
+
+/**
+ * Deserialize whole batch of records using a pool of threads.
+ *
+ * Records are split into chunks of chunk_len records. Every worker, including the calling thread, takes
+ * the next free chunk as soon as it finishes its previous one, so faster workers pick up the work left
+ * by slower ones. Output structs are preallocated by the caller in p_batch->p_output.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param p_batch       Batch description.
+ * @param no_threads    Number of threads to use, including calling thread, clamped to BIT_PARALLEL_MAX_THREADS.
+ * @param chunk_len     Number of records in a chunk, 0 for BIT_PARALLEL_DEFAULT_CHUNK.
+ * @return              Status. If decoding of more than one chunk fails, status of one of them.
+ */
+Status_T BitParallel_DeserializeBatch(const BitField_T * p_fields, size_t no_fields, const BitBatch_T * p_batch,
+                                      size_t no_threads, size_t chunk_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //BIT_PARALLEL_H
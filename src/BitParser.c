@@ -27,415 +27,2908 @@
 #include "UParser.h"
 #include "BitParserError.h"
 
+#if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED)
+/**
+ * CRC lookup table processing 4 bits at a time.
+ */
+typedef struct {
+    uint32_t poly;          /*!< Polynomial in normal form. */
+    bool     reflected;     /*!< True for bit reflected algorithm. */
+    uint32_t table[16];     /*!< Table indexed by nibble. */
+} CrcTable_T;
+#endif
+
+#ifdef BIT_FIELD_CRC16_ENABLED
+static const CrcTable_T crc16_tables[] = {
+    {0x8005, false, {0x0000, 0x8005, 0x800F, 0x000A, 0x801B, 0x001E, 0x0014, 0x8011,
+                     0x8033, 0x0036, 0x003C, 0x8039, 0x0028, 0x802D, 0x8027, 0x0022}},
+    {0x8005, true,  {0x0000, 0xCC01, 0xD801, 0x1400, 0xF001, 0x3C00, 0x2800, 0xE401,
+                     0xA001, 0x6C00, 0x7800, 0xB401, 0x5000, 0x9C01, 0x8801, 0x4400}},
+    {0x1021, false, {0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+                     0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF}},
+    {0x1021, true,  {0x0000, 0x1081, 0x2102, 0x3183, 0x4204, 0x5285, 0x6306, 0x7387,
+                     0x8408, 0x9489, 0xA50A, 0xB58B, 0xC60C, 0xD68D, 0xE70E, 0xF78F}},
+};
+#endif
+
+#ifdef BIT_FIELD_CRC32_ENABLED
+static const CrcTable_T crc32_tables[] = {
+    {0x04C11DB7, false, {0x00000000, 0x04C11DB7, 0x09823B6E, 0x0D4326D9, 0x130476DC, 0x17C56B6B, 0x1A864DB2,
+                         0x1E475005, 0x2608EDB8, 0x22C9F00F, 0x2F8AD6D6, 0x2B4BCB61, 0x350C9B64, 0x31CD86D3,
+                         0x3C8EA00A, 0x384FBDBD}},
+    {0x04C11DB7, true,  {0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158,
+                         0x5005713C, 0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4,
+                         0xA00AE278, 0xBDBDF21C}},
+};
+#endif
+
+/**
+ * Serialize fields of a message starting from given one.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param first         Index of the first field to serialize.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to be serialized.
+ * @param p_stream      Stream to write data.
+ * @param p_index       Output index of failed field, set on failure only.
+ * @return              Status.
+ */
+static Status_T SerializeFields(const BitField_T * p_fields, size_t first, size_t no_fields, void * data,
+                                Stream_T * p_stream, size_t * p_index);
+
+/**
+ * Serialize automatic LEN field followed by the rest of message. LEN field bits are reserved, the rest
+ * of message is serialized and its length in bytes is written back to LEN field and to the struct.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param index         Index of automatic LEN field.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to be serialized.
+ * @param p_stream      Stream to write data.
+ * @param p_index       Output index of failed field, set on failure only.
+ * @return              Status.
+ */
+static Status_T SerializeAutoLen(const BitField_T * p_fields, size_t index, size_t no_fields, void * data,
+                                 Stream_T * p_stream, size_t * p_index);
+
+/**
+ * Serialize again checksum fields following a field written after them, which cover it directly or
+ * through another refreshed checksum.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param index         Index of field written after checksums.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to be serialized.
+ * @param p_stream      Stream holding serialized message.
+ * @param bit_index     Stream bit index of field index + 1.
+ * @param changed       Stream byte index past the field written after checksums.
+ * @param p_index       Output index of failed field, set on failure only.
+ * @return              Status.
+ */
+static Status_T RefreshChecksums(const BitField_T * p_fields, size_t index, size_t no_fields, void * data,
+                                 Stream_T * p_stream, size_t bit_index, size_t changed, size_t * p_index);
+
+/**
+ * Serialize struct atomically, see BitParser_Serialize.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to be serialized.
+ * @param p_stream      Stream to write data.
+ * @param p_error       Error context filled on failure, may be NULL.
+ * @return              Status.
+ */
+static Status_T SerializeMessage(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                 BitError_T * p_error);
+
+/**
+ * Fill error context of a failed field. Shall be called before stream position is restored.
+ *
+ * @param p_error       Error context.
+ * @param p_fields      Bit field message descriptor.
+ * @param index         Index of failed field.
+ * @param data          Structure being processed.
+ * @param p_stream      Stream at the failure position.
+ * @param status        Status of the failure.
+ * @param serialize     True if failure happened during serialization.
+ */
+static void FillError(BitError_T * p_error, const BitField_T * p_fields, size_t index, void * data,
+                      Stream_T * p_stream, Status_T status, bool serialize);
+
+/**
+ * Get length of ARRAY_VARIABLE_WHOLE_MSG field, ie. value of its LEN field minus bytes of fields between
+ * the LEN field and this one. When serializing with automatic LEN field, the LEN value is not known yet
+ * and the struct value is the array length itself.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param index         Index of ARRAY_VARIABLE_WHOLE_MSG field in descriptor.
+ * @param data          Structure with LEN field value.
+ * @param serialize     True if length is needed for serialization.
+ * @param p_len         Output length in bytes.
+ * @return              Status. ERROR_LEN_FIELD_MISSING if LEN field does not precede the field,
+ *                      ERROR_STREAM_TOO_SHORT if LEN value is shorter than fields it covers.
+ */
+static Status_T GetWholeMsgLength(const BitField_T * p_fields, size_t index, void * data, bool serialize,
+                                  size_t * p_len);
+
+/**
+ * Serialize or deserialize ARRAY_VARIABLE_WHOLE_MSG field. Deserialized field aligned to byte boundary
+ * is not copied, its pointer is set to the stream buffer.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param index         Index of ARRAY_VARIABLE_WHOLE_MSG field in descriptor.
+ * @param data          Structure to serialize from or deserialize to.
+ * @param p_stream      Stream to write or read data.
+ * @param serialize     True to serialize, false to deserialize.
+ * @param p_arena       Arena for not aligned deserialized field. May be NULL.
+ * @return              Status.
+ */
+static Status_T ProcessWholeMsg(const BitField_T * p_fields, size_t index, void * data, Stream_T * p_stream,
+                                bool serialize, BitArena_T * p_arena);
+
+/**
+ * Deserialize stream into struct, with variable arrays and REPEATED items allocated from arena.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to write data.
+ * @param p_stream      Stream to read data.
+ * @param p_arena       Arena, NULL to use arrays the struct points to.
+ * @param p_error       Error context filled on failure, may be NULL.
+ * @return              Status.
+ */
+static Status_T DeserializeMessage(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                   BitArena_T * p_arena, BitError_T * p_error);
+
+/**
+ * Deserialize single field of a message struct, with variable arrays and REPEATED items allocated from arena.
+ *
+ * @param p_field       Bit field description.
+ * @param data          Structure to write data.
+ * @param p_stream      Stream to read data.
+ * @param p_arena       Arena.
+ * @return              Status. ERROR_BUFFER_TOO_SHORT if arena is exhausted.
+ */
+static Status_T DeserializeArenaField(const BitField_T * p_field, void * data, Stream_T * p_stream,
+                                      BitArena_T * p_arena);
+
+#if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED) || defined(BIT_FIELD_SUM8_ENABLED)
+/**
+ * Calculate checksum of bytes.
+ *
+ * @param p_field   Checksum field description.
+ * @param p_bytes   Bytes covered by checksum.
+ * @param len       Number of bytes.
+ * @return          Checksum.
+ */
+static uint32_t CalculateChecksum(const BitField_T * p_field, const uint8_t * p_bytes, size_t len);
+
+/**
+ * Calculate checksum of stream bytes covered by checksum field, ie. from its start byte up to the current
+ * stream position.
+ *
+ * @param p_field       Checksum field description.
+ * @param p_stream      Stream positioned at checksum field.
+ * @param p_checksum    Output checksum.
+ * @return              Status.
+ */
+static Status_T CalculateStreamChecksum(const BitField_T * p_field, Stream_T * p_stream, uint32_t * p_checksum);
+
+/**
+ * Store checksum in struct value of checksum field type.
+ *
+ * @param p_field   Checksum field description.
+ * @param p_value   Pointer to value.
+ * @param checksum  Checksum.
+ */
+static void StoreChecksum(const BitField_T * p_field, void * p_value, uint32_t checksum);
+
+/**
+ * Load checksum from struct value of checksum field type.
+ *
+ * @param p_field   Checksum field description.
+ * @param p_value   Pointer to value.
+ * @return          Checksum.
+ */
+static uint32_t LoadChecksum(const BitField_T * p_field, const void * p_value);
+#endif
+
+#if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED)
+/**
+ * Get CRC lookup table of checksum field, static one for common polynomials.
+ *
+ * @param p_field   CRC16 or CRC32 field description.
+ * @param width     CRC width in bits.
+ * @param p_scratch Storage for 16 entries of table built for other polynomials.
+ * @return          Lookup table.
+ */
+static const uint32_t * GetCrcTable(const BitField_T * p_field, size_t width, uint32_t * p_scratch);
+#endif
+
+/**
+ * Serialize value of a field with byte order override.
+ *
+ * @param p_field       Bit field description.
+ * @param p_value       Value to serialize.
+ * @param p_stream      Stream to write data.
+ * @return              Status.
+ */
+static Status_T SerializeOrdered(const BitField_T * p_field, void * p_value, Stream_T * p_stream);
+
+/**
+ * Deserialize value of a field with byte order override.
+ *
+ * @param p_field       Bit field description.
+ * @param p_value       Value to write data.
+ * @param p_stream      Stream to read data.
+ * @return              Status.
+ */
+static Status_T DeserializeOrdered(const BitField_T * p_field, void * p_value, Stream_T * p_stream);
+
+/**
+ * Reverse order of 16 bit words in a byte array.
+ *
+ * @param p_bytes       Bytes to reorder.
+ * @param len           Number of bytes, multiple of 2.
+ */
+static void SwapWords(uint8_t * p_bytes, size_t len);
+
+/**
+ * Get byte size of a field if it is an integer of native width, ie. one that can be copied between byte
+ * aligned stream and struct without any bit manipulation.
+ *
+ * @param p_field       Bit field description.
+ * @return              Size of field in bytes or 0 if field is not native.
+ */
+static size_t GetNativeSize(const BitField_T * p_field);
+
+/**
+ * Find run of native fields starting at current stream position, which fits into the stream.
+ *
+ * @param p_fields      Bit field message descriptor, starting at first field of the run.
+ * @param no_fields     Number of remaining fields in descriptor.
+ * @param p_stream      Stream to read or write data.
+ * @return              Number of fields in run, 0 if stream is not byte aligned or first field is not native.
+ */
+static size_t GetNativeRun(const BitField_T * p_fields, size_t no_fields, Stream_T * p_stream);
+
+/**
+ * Serialize or deserialize run of native fields with plain byte loads and stores. Run shall be found
+ * with GetNativeRun, so it is already bounds checked.
+ *
+ * @param p_fields      Bit field message descriptor, starting at first field of the run.
+ * @param no_fields     Number of fields in run.
+ * @param data          Message struct.
+ * @param p_stream      Stream to read or write data.
+ * @param serialize     True to serialize, false to deserialize.
+ */
+static void ProcessNativeRun(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                             bool serialize);
+
+/**
+ * Load integer from bytes in given byte order.
+ *
+ * @param p_bytes       Bytes to load.
+ * @param size          Number of bytes.
+ * @param mode          Byte order.
+ * @return              Loaded value.
+ */
+static inline uint64_t LoadBytes(const uint8_t * p_bytes, size_t size, Stream_Mode_T mode);
+
+/**
+ * Store integer into bytes in given byte order.
+ *
+ * @param p_bytes       Output bytes.
+ * @param value         Value to store.
+ * @param size          Number of bytes.
+ * @param mode          Byte order.
+ */
+static inline void StoreBytes(uint8_t * p_bytes, uint64_t value, size_t size, Stream_Mode_T mode);
+
+/**
+ * Calculate len of serialized message in bits, starting at given stream bit index.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to be serialized. May be NULL for messages of fixed length.
+ * @param bit_index     Stream bit index the message starts at.
+ * @return              Message length in bits.
+ */
+static size_t GetMessageLengthBit(const BitField_T * p_fields, size_t no_fields, void * data, size_t bit_index);
+
+/**
+ * Add lengths, saturating at SIZE_MAX.
+ *
+ * @param a     First length.
+ * @param b     Second length.
+ * @return      Sum or SIZE_MAX if it does not fit size_t.
+ */
+static inline size_t AddSaturated(size_t a, size_t b);
+
+/**
+ * Multiply lengths, saturating at SIZE_MAX.
+ *
+ * @param a     First length.
+ * @param b     Second length.
+ * @return      Product or SIZE_MAX if it does not fit size_t.
+ */
+static inline size_t MulSaturated(size_t a, size_t b);
+
+/**
+ * Calculate len of serialized message in bits if it does not depend on message content nor position
+ * in stream.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param p_bit         Output message length in bits.
+ * @return              True if message has fixed length.
+ */
+static bool GetFixedLengthBit(const BitField_T * p_fields, size_t no_fields, size_t * p_bit);
+
+/**
+ * Serialize or deserialize items of REPEATED field. If item has fixed length, whole array is bounds
+ * checked once up front.
+ *
+ * @param p_field       REPEATED field description.
+ * @param data          Message struct.
+ * @param p_stream      Stream to read or write data.
+ * @param serialize     True to serialize, false to deserialize.
+ * @param p_arena       Arena to allocate deserialized items from. May be NULL.
+ * @return              Status.
+ */
+static Status_T ProcessRepeated(const BitField_T * p_field, void * data, Stream_T * p_stream, bool serialize,
+                                BitArena_T * p_arena);
+
+/**
+ * Check if length of serialized field depends on message content or on its position in stream.
+ *
+ * @param p_field       Bit field description.
+ * @param known_index   True if stream bit index of the field is known in advance.
+ * @return              True if field has variable length.
+ */
+static bool IsVariableLength(const BitField_T * p_field, bool known_index);
+
+/**
+ * Read tag of UNION field from message struct.
+ *
+ * @param p_field       UNION field description.
+ * @param data          Message struct.
+ * @return              Tag value.
+ */
+static uint64_t GetUnionTag(const BitField_T * p_field, void * data);
+
+/**
+ * Move field description by offset, ie. make it describe the same field of a struct embedded in
+ * another struct at given offset.
+ *
+ * @param p_field   Bit field description.
+ * @param offset    Offset of embedded struct in bytes.
+ */
+static void MoveField(BitField_T * p_field, size_t offset);
+
+/**
+ * Recursive part of BitParser_Flatten.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param offset        Offset of described struct in the outermost struct.
+ * @param p_output      Output flat descriptor.
+ * @param max_fields    Size of output descriptor.
+ * @param p_no_output   Number of fields already in output, updated.
+ * @return              Status.
+ */
+static Status_T Flatten(const BitField_T * p_fields, size_t no_fields, size_t offset, BitField_T * p_output,
+                        size_t max_fields, size_t * p_no_output);
+
+/**
+ * Check if LEN field with given struct offset precedes a field in descriptor.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param index         Index of field in descriptor.
+ * @param offset        Struct offset of LEN field value.
+ * @return              True if LEN field precedes the field.
+ */
+static bool HasLenBefore(const BitField_T * p_fields, size_t index, size_t offset);
+
+/**
+ * Validate single field of a descriptor, see BitParser_Validate.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param index         Index of field in descriptor.
+ * @return              Status.
+ */
+static Status_T ValidateField(const BitField_T * p_fields, size_t index);
+
+/**
+ * Check if field can be deserialized into a column, see BitParser_DeserializeColumns.
+ *
+ * @param p_field       Bit field description.
+ * @return              True for compiled in integer, FLOAT, DOUBLE, LEN, ARRAY_FIXED, ALIGN and PAD fields.
+ */
+static bool IsColumnField(const BitField_T * p_field);
+
+/**
+ * Check if field holds the tag of a following UNION field, see BitParser_FindUnionTag.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param index         Index of field in descriptor.
+ * @return              True if field is a UNION tag.
+ */
+static bool IsUnionTag(const BitField_T * p_fields, size_t no_fields, size_t index);
+
 Status_T BitParser_Serialize(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream) {
     ASSERT(p_fields != NULL);
     ASSERT(data != NULL);
     ASSERT(p_stream != NULL);
 
-    Status_T result = STATUS_SUCCESS;
+    return SerializeMessage(p_fields, no_fields, data, p_stream, NULL);
+}
+
+Status_T BitParser_SerializeEx(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                               BitError_T * p_error) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+
+    return SerializeMessage(p_fields, no_fields, data, p_stream, p_error);
+}
+
+Status_T BitParser_Deserialize(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+
+    return DeserializeMessage(p_fields, no_fields, data, p_stream, NULL, NULL);
+}
+
+Status_T BitParser_DeserializeEx(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                 BitError_T * p_error) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+
+    return DeserializeMessage(p_fields, no_fields, data, p_stream, NULL, p_error);
+}
+
+Status_T BitParser_DeserializeArena(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                    BitArena_T * p_arena) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_arena != NULL);
+
+    return DeserializeMessage(p_fields, no_fields, data, p_stream, p_arena, NULL);
+}
+
+Status_T BitParser_DeserializeArenaEx(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                      BitArena_T * p_arena, BitError_T * p_error) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_arena != NULL);
+
+    return DeserializeMessage(p_fields, no_fields, data, p_stream, p_arena, p_error);
+}
+
+Status_T BitParser_DeserializeSelected(const BitField_T * p_fields, size_t no_fields, const uint8_t * p_mask,
+                                       void * data, Stream_T * p_stream) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_mask != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+
+    Status_T result    = STATUS_SUCCESS;
+    size_t   skip      = 0;
+    size_t   bit_index = Stream_TellBit(p_stream);
+    Stream_T frame;
+
+    Stream_OpenFrame(&frame, p_stream, bit_index);
+
+    for(size_t i = 0; i < no_fields; i++) {
+        bool selected = BIT_PARSER_MASK_IS_SET(p_mask, i);
+
+        switch(p_fields[i].field_type) {
+            case LEN:
+            case SUBMSG:
+            case UNION:
+            case REPEATED:
+            case ARRAY_VARIABLE_WHOLE_MSG:
+                selected = true;
+                break;
+
+            default:
+                break;
+        }
+
+        if(!selected && IsUnionTag(p_fields, no_fields, i))
+            selected = true;
+
+        if(!selected) {
+            skip += BitParser_GetMessageFieldLengthBit(p_fields, i, data, Stream_TellBit(&frame) + skip);
+            continue;
+        }
+
+        if(skip != 0) {
+            result = Stream_SeekBit(&frame, Stream_TellBit(&frame) + skip);
+            if(result != STATUS_SUCCESS)
+                break;
+
+            skip = 0;
+        }
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+        if(p_fields[i].field_type == ARRAY_VARIABLE_WHOLE_MSG)
+            result = ProcessWholeMsg(p_fields, i, data, &frame, false, NULL);
+        else
+        #endif
+        result = BitParser_DeserializeField(&p_fields[i], data, &frame);
+        if(result != STATUS_SUCCESS)
+            break;
+    }
+
+    if(result == STATUS_SUCCESS && skip != 0)
+        result = Stream_SeekBit(&frame, Stream_TellBit(&frame) + skip);
+
+    Stream_CloseFrame(p_stream, &frame);
+
+    if(result != STATUS_SUCCESS)
+        Stream_SeekBit(p_stream, bit_index);
+
+    return result;
+}
+
+Status_T BitParser_DeserializeColumns(const BitField_T * p_fields, size_t no_fields, void * const * p_columns,
+                                      size_t no_records, Stream_T * p_stream) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_columns != NULL);
+    ASSERT(p_stream != NULL);
+
+    for(size_t i = 0; i < no_fields; i++) {
+        if(!IsColumnField(&p_fields[i]))
+            return ERROR_DESCRIPTOR_INVALID;
+    }
+
+    size_t bit_index = Stream_TellBit(p_stream);
+
+    for(size_t record = 0; record < no_records; record++) {
+        for(size_t i = 0; i < no_fields; i++) {
+            Status_T result;
+
+            switch(p_fields[i].field_type) {
+                #if defined(BIT_FIELD_ALIGN_ENABLED) || defined(BIT_FIELD_PAD_ENABLED)
+                #ifdef BIT_FIELD_ALIGN_ENABLED
+                case ALIGN:
+                #endif
+                #ifdef BIT_FIELD_PAD_ENABLED
+                case PAD:
+                #endif
+                    result = BitParser_DeserializeField(&p_fields[i], NULL, p_stream);
+                    break;
+                #endif
+
+                default:
+                    ASSERT(p_columns[i] != NULL);
+                    result = BitParser_DeserializeValue(&p_fields[i], (uint8_t *) p_columns[i] +
+                                                        record * BitParser_GetValueSize(&p_fields[i]), p_stream);
+                    break;
+            }
+
+            if(result != STATUS_SUCCESS) {
+                Stream_SeekBit(p_stream, bit_index);
+                return result;
+            }
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+Status_T BitParser_GetBatchRecord(const BitBatch_T * p_batch, size_t index, uint8_t ** pp_record, size_t * p_len) {
+    ASSERT(p_batch != NULL);
+    ASSERT(index < p_batch->no_records);
+    ASSERT(pp_record != NULL);
+    ASSERT(p_len != NULL);
+
+    size_t start, end;
+
+    if(p_batch->p_index != NULL) {
+        start = p_batch->p_index[index];
+        end   = index + 1 < p_batch->no_records ? p_batch->p_index[index + 1] : p_batch->len;
+    }
+    else {
+        start = index * p_batch->record_len;
+        end   = start + p_batch->record_len;
+    }
+
+    if(end > p_batch->len || start >= end)
+        return ERROR_STREAM_TOO_SHORT;
+
+    (*pp_record) = p_batch->p_buffer + start;
+    (*p_len)     = end - start;
+
+    return STATUS_SUCCESS;
+}
+
+Status_T BitParser_DeserializeBatch(const BitField_T * p_fields, size_t no_fields, const BitBatch_T * p_batch,
+                                    size_t first, size_t count) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_batch != NULL);
+    ASSERT(p_batch->p_buffer != NULL);
+    ASSERT(p_batch->p_output != NULL);
+    ASSERT(first + count <= p_batch->no_records);
+
+    for(size_t i = first; i < first + count; i++) {
+        uint8_t * p_record;
+        size_t    len;
+
+        Status_T result = BitParser_GetBatchRecord(p_batch, i, &p_record, &len);
+        if(result != STATUS_SUCCESS)
+            return result;
+
+        Stream_T stream;
+        Stream_Init(&stream, p_record, len, p_batch->mode);
+
+        result = BitParser_Deserialize(p_fields, no_fields,
+                                                (uint8_t *) p_batch->p_output + i * p_batch->output_size,
+                                                &stream);
+        if(result != STATUS_SUCCESS)
+            return result;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+Status_T BitParser_SerializeField(const BitField_T * p_field, void * data, Stream_T * p_stream) {
+    ASSERT_HOT(p_field != NULL);
+    ASSERT_HOT(p_stream != NULL);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+            return Array_SerializeBit(*((uint8_t **) (data + p_field->array_fixed_f.offset)),
+                                      p_field->array_fixed_f.len,
+                                      p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
+        case ARRAY_VARIABLE:
+            return Array_SerializeBit(*((uint8_t **) (data + p_field->array_variable_f.offset)),
+                                      *((size_t *) (data + p_field->array_variable_f.len_offset)),
+                                      p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+        case ARRAY_VARIABLE_WHOLE_MSG:
+            return ERROR_DESCRIPTOR_INVALID;
+        #endif
+
+        #ifdef BIT_FIELD_ALIGN_ENABLED
+        case ALIGN:
+            Stream_Align(p_stream);
+            return STATUS_SUCCESS;
+        #endif
+
+        #ifdef BIT_FIELD_PAD_ENABLED
+        case PAD:
+            return Stream_SeekBit(p_stream, Stream_TellBit(p_stream) + p_field->pad_f.bit);
+        #endif
+
+        #ifdef BIT_FIELD_SUBMSG_ENABLED
+        case SUBMSG:
+            return BitParser_Serialize(p_field->submsg_f.p_fields, p_field->submsg_f.no_fields,
+                                       data + p_field->submsg_f.offset, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_UNION_ENABLED
+        case UNION: {
+            ASSERT_HOT(data != NULL);
+            const BitUnionCase_T * p_case = BitParser_FindUnionCase(p_field, GetUnionTag(p_field, data));
+            if(p_case == NULL)
+                return ERROR_UNION_TAG_UNKNOWN;
+
+            return BitParser_Serialize(p_case->p_fields, p_case->no_fields, data + p_field->union_f.offset, p_stream);
+        }
+        #endif
+
+        #ifdef BIT_FIELD_REPEATED_ENABLED
+        case REPEATED:
+            ASSERT_HOT(data != NULL);
+            return ProcessRepeated(p_field, data, p_stream, true, NULL);
+        #endif
+
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+        #endif
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+        #endif
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+        #endif
+        #if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED) || defined(BIT_FIELD_SUM8_ENABLED)
+        {
+            ASSERT_HOT(data != NULL);
+            uint32_t checksum;
+            Status_T result = CalculateStreamChecksum(p_field, p_stream, &checksum);
+            if(result != STATUS_SUCCESS)
+                return result;
+
+            StoreChecksum(p_field, data + p_field->checksum_f.offset, checksum);
+            return BitParser_SerializeValue(p_field, data + p_field->checksum_f.offset, p_stream);
+        }
+        #endif
+
+        default:
+            ASSERT_HOT(data != NULL);
+            return BitParser_SerializeValue(p_field, data + BitParser_GetFieldOffset(p_field), p_stream);
+    }
+}
+
+Status_T BitParser_DeserializeField(const BitField_T * p_field, void * data, Stream_T * p_stream) {
+    ASSERT_HOT(p_field != NULL);
+    ASSERT_HOT(p_stream != NULL);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+            return Array_DeserializeBit(*((uint8_t **) (data + p_field->array_fixed_f.offset)),
+                                        p_field->array_fixed_f.len,
+                                        p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
+        case ARRAY_VARIABLE:
+            return Array_DeserializeBit(*((uint8_t **) (data + p_field->array_variable_f.offset)),
+                                        *((size_t *) (data + p_field->array_variable_f.len_offset)),
+                                        p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+        case ARRAY_VARIABLE_WHOLE_MSG:
+            return ERROR_DESCRIPTOR_INVALID;
+        #endif
+
+        #ifdef BIT_FIELD_ALIGN_ENABLED
+        case ALIGN:
+            Stream_Align(p_stream);
+            return STATUS_SUCCESS;
+        #endif
+
+        #ifdef BIT_FIELD_PAD_ENABLED
+        case PAD:
+            return Stream_SeekBit(p_stream, Stream_TellBit(p_stream) + p_field->pad_f.bit);
+        #endif
+
+        #ifdef BIT_FIELD_SUBMSG_ENABLED
+        case SUBMSG:
+            return BitParser_Deserialize(p_field->submsg_f.p_fields, p_field->submsg_f.no_fields,
+                                         data + p_field->submsg_f.offset, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_UNION_ENABLED
+        case UNION: {
+            ASSERT_HOT(data != NULL);
+            const BitUnionCase_T * p_case = BitParser_FindUnionCase(p_field, GetUnionTag(p_field, data));
+            if(p_case == NULL)
+                return ERROR_UNION_TAG_UNKNOWN;
+
+            return BitParser_Deserialize(p_case->p_fields, p_case->no_fields, data + p_field->union_f.offset, p_stream);
+        }
+        #endif
+
+        #ifdef BIT_FIELD_REPEATED_ENABLED
+        case REPEATED:
+            ASSERT_HOT(data != NULL);
+            return ProcessRepeated(p_field, data, p_stream, false, NULL);
+        #endif
+
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+        #endif
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+        #endif
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+        #endif
+        #if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED) || defined(BIT_FIELD_SUM8_ENABLED)
+        {
+            ASSERT_HOT(data != NULL);
+            uint32_t checksum;
+            Status_T result = CalculateStreamChecksum(p_field, p_stream, &checksum);
+            if(result != STATUS_SUCCESS)
+                return result;
+
+            result = BitParser_DeserializeValue(p_field, data + p_field->checksum_f.offset, p_stream);
+            if(result != STATUS_SUCCESS)
+                return result;
+
+            return LoadChecksum(p_field, data + p_field->checksum_f.offset) == checksum ? STATUS_SUCCESS
+                                                                                       : ERROR_CHECKSUM_MISMATCH;
+        }
+        #endif
+
+        default:
+            ASSERT_HOT(data != NULL);
+            return BitParser_DeserializeValue(p_field, data + BitParser_GetFieldOffset(p_field), p_stream);
+    }
+}
+
+const BitUnionCase_T * BitParser_FindUnionCase(const BitField_T * p_field, uint64_t tag) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_field->field_type == UNION);
+
+    const BitUnionCase_T * p_cases  = p_field->union_f.p_cases;
+    size_t                 no_cases = p_field->union_f.no_cases;
+
+    if(tag < no_cases && p_cases[tag].tag == tag)
+        return &p_cases[tag];
+
+    size_t low  = 0;
+    size_t high = no_cases;
+    while(low < high) {
+        size_t middle = low + (high - low) / 2;
+
+        if(p_cases[middle].tag == tag)
+            return &p_cases[middle];
+        else if(p_cases[middle].tag < tag)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return NULL;
+}
+
+size_t BitParser_FindUnionTag(const BitField_T * p_fields, size_t index) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_fields[index].field_type == UNION);
+
+    for(size_t i = index; i-- > 0;) {
+        if(p_fields[i].field_type == ALIGN || p_fields[i].field_type == PAD)
+            continue;
+
+        if(BitParser_GetFieldOffset(&p_fields[i]) == p_fields[index].union_f.tag_offset)
+            return i;
+    }
+
+    return index;
+}
+
+Status_T BitParser_Flatten(const BitField_T * p_fields, size_t no_fields, BitField_T * p_output, size_t max_fields,
+                           size_t * p_no_output) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_output != NULL);
+    ASSERT(p_no_output != NULL);
+
+    (*p_no_output) = 0;
+    return Flatten(p_fields, no_fields, 0, p_output, max_fields, p_no_output);
+}
+
+Status_T BitParser_Validate(const BitField_T * p_fields, size_t no_fields) {
+    ASSERT(p_fields != NULL || no_fields == 0);
+
+    for(size_t i = 0; i < no_fields; i++) {
+        Status_T result = ValidateField(p_fields, i);
+        if(result != STATUS_SUCCESS)
+            return result;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+size_t BitParser_GetFieldLengthBit(const BitField_T * p_field, void * data, size_t bit_index) {
+    ASSERT_HOT(p_field != NULL);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_U8_ENABLED
+        case U8:
+            return p_field->u8_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_I8_ENABLED
+        case I8:
+            return p_field->i8_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_S8_ENABLED
+        case S8:
+            return p_field->s8_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_U16_ENABLED
+        case U16:
+            return p_field->u16_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_I16_ENABLED
+        case I16:
+            return p_field->i16_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_S16_ENABLED
+        case S16:
+            return p_field->s16_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_U32_ENABLED
+        case U32:
+            return p_field->u32_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_I32_ENABLED
+        case I32:
+            return p_field->i32_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_S32_ENABLED
+        case S32:
+            return p_field->s32_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_U64_ENABLED
+        case U64:
+            return p_field->u64_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_I64_ENABLED
+        case I64:
+            return p_field->i64_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_S64_ENABLED
+        case S64:
+            return p_field->s64_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_FLOAT_ENABLED
+        case FLOAT:
+            return sizeof(float) * BITS_IN_BYTE;
+        #endif
+
+        #ifdef BIT_FIELD_DOUBLE_ENABLED
+        case DOUBLE:
+            return sizeof(double) * BITS_IN_BYTE;
+        #endif
+
+        #ifdef BIT_FIELD_LEN_ENABLED
+        case LEN:
+            return p_field->len_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+            return p_field->array_fixed_f.len * BITS_IN_BYTE;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
+        case ARRAY_VARIABLE:
+            ASSERT_HOT(data != NULL);
+            return MulSaturated(*((size_t *) (data + p_field->array_variable_f.len_offset)), BITS_IN_BYTE);
+        #endif
+
+        #ifdef BIT_FIELD_ALIGN_ENABLED
+        case ALIGN:
+            return bit_index % BITS_IN_BYTE != 0 ? BITS_IN_BYTE - bit_index % BITS_IN_BYTE : 0;
+        #endif
+
+        #ifdef BIT_FIELD_PAD_ENABLED
+        case PAD:
+            return p_field->pad_f.bit;
+        #endif
+
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+            return 16;
+        #endif
+
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+            return 32;
+        #endif
+
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+            return 8;
+        #endif
+
+        #ifdef BIT_FIELD_SUBMSG_ENABLED
+        case SUBMSG:
+            return GetMessageLengthBit(p_field->submsg_f.p_fields, p_field->submsg_f.no_fields,
+                                       data != NULL ? data + p_field->submsg_f.offset : NULL, bit_index);
+        #endif
+
+        #ifdef BIT_FIELD_UNION_ENABLED
+        case UNION: {
+            ASSERT_HOT(data != NULL);
+            const BitUnionCase_T * p_case = BitParser_FindUnionCase(p_field, GetUnionTag(p_field, data));
+            if(p_case == NULL)
+                return 0;
+
+            return GetMessageLengthBit(p_case->p_fields, p_case->no_fields, data + p_field->union_f.offset, bit_index);
+        }
+        #endif
+
+        #ifdef BIT_FIELD_REPEATED_ENABLED
+        case REPEATED: {
+            ASSERT_HOT(data != NULL);
+            size_t count = *(size_t*)(data + p_field->repeated_f.count_offset);
+            size_t item_bit;
+
+            if(GetFixedLengthBit(p_field->repeated_f.p_fields, p_field->repeated_f.no_fields, &item_bit))
+                return MulSaturated(count, item_bit);
+
+            uint8_t * p_items = *(uint8_t**)(data + p_field->repeated_f.offset);
+            size_t    result  = 0;
+            for(size_t i = 0; i < count; i++)
+                result = AddSaturated(result, GetMessageLengthBit(p_field->repeated_f.p_fields,
+                                                                  p_field->repeated_f.no_fields,
+                                                                  p_items + i * p_field->repeated_f.stride,
+                                                                  bit_index + result));
+
+            return result;
+        }
+        #endif
+
+        default:
+            UNREACHABLE();
+            return 0;
+    }
+}
+
+size_t BitParser_GetMessageFieldLengthBit(const BitField_T * p_fields, size_t index, void * data, size_t bit_index) {
+    ASSERT_HOT(p_fields != NULL);
+
+    #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+    if(p_fields[index].field_type == ARRAY_VARIABLE_WHOLE_MSG) {
+        ASSERT_HOT(data != NULL);
+        size_t len;
+        if(GetWholeMsgLength(p_fields, index, data, false, &len) != STATUS_SUCCESS)
+            return 0;
+
+        return MulSaturated(len, BITS_IN_BYTE);
+    }
+    #endif
+
+    return BitParser_GetFieldLengthBit(&p_fields[index], data, bit_index);
+}
+
+size_t BitParser_GetLengthBit(const BitField_T * p_fields, size_t no_fields, void * data)  {
+    ASSERT(p_fields != NULL);
+
+    return GetMessageLengthBit(p_fields, no_fields, data, 0);
+}
+
+size_t BitParser_GetLength(const BitField_T * p_fields, size_t no_fields, void * data) {
+    ASSERT(p_fields != NULL);
+
+    size_t bit = BitParser_GetLengthBit(p_fields, no_fields, data);
+    return bit / BITS_IN_BYTE + (bit % BITS_IN_BYTE != 0 ? 1 : 0);
+}
+
+Status_T BitParser_InitLengthProfile(BitLengthProfile_T * p_self, const BitField_T * p_fields, size_t no_fields,
+                                     BitLengthTerm_T * p_terms, size_t max_terms) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_fields != NULL);
+    ASSERT(p_terms != NULL || max_terms == 0);
+
+    p_self->p_fields   = p_fields;
+    p_self->p_terms    = p_terms;
+    p_self->no_terms   = 0;
+    p_self->static_bit = 0;
+
+    size_t bit = 0;
+    for(size_t i = 0; i < no_fields; i++) {
+        const BitField_T * p_field = &p_fields[i];
+
+        if(!IsVariableLength(p_field, p_self->no_terms == 0)) {
+            size_t len = BitParser_GetFieldLengthBit(p_field, NULL, bit);
+            p_self->static_bit += len;
+            bit                += len;
+            continue;
+        }
+
+        if(p_self->no_terms >= max_terms)
+            return ERROR_BUFFER_TOO_SHORT;
+
+        p_terms[p_self->no_terms].field      = i;
+        p_terms[p_self->no_terms].static_bit = p_self->static_bit;
+        p_self->no_terms++;
+        p_self->static_bit = 0;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+size_t BitParser_GetProfileLengthBit(const BitLengthProfile_T * p_self, void * data) {
+    ASSERT(p_self != NULL);
+
+    size_t result = 0;
+    for(size_t i = 0; i < p_self->no_terms; i++) {
+        result = AddSaturated(result, p_self->p_terms[i].static_bit);
+        result = AddSaturated(result, BitParser_GetMessageFieldLengthBit(p_self->p_fields, p_self->p_terms[i].field,
+                                                                         data, result));
+    }
+
+    return AddSaturated(result, p_self->static_bit);
+}
+
+size_t BitParser_GetProfileLength(const BitLengthProfile_T * p_self, void * data) {
+    ASSERT(p_self != NULL);
+
+    size_t bit = BitParser_GetProfileLengthBit(p_self, data);
+    return bit / BITS_IN_BYTE + (bit % BITS_IN_BYTE != 0 ? 1 : 0);
+}
+
+Status_T BitParser_SerializeValue(const BitField_T * p_field, void * p_value, Stream_T * p_stream) {
+    ASSERT_HOT(p_field != NULL);
+    ASSERT_HOT(p_value != NULL);
+    ASSERT_HOT(p_stream != NULL);
+
+    if(p_field->order != BIT_ORDER_STREAM)
+        return SerializeOrdered(p_field, p_value, p_stream);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_U8_ENABLED
+        case U8:
+            return U8_SerializeBit(p_value, p_field->u8_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_I8_ENABLED
+        case I8:
+            return I8_SerializeBit(p_value, p_field->i8_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_S8_ENABLED
+        case S8:
+            return S8_SerializeBit(p_value, p_field->s8_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_U16_ENABLED
+        case U16:
+            return U16_SerializeBit(p_value, p_field->u16_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_I16_ENABLED
+        case I16:
+            return I16_SerializeBit(p_value, p_field->i16_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_S16_ENABLED
+        case S16:
+            return S16_SerializeBit(p_value, p_field->s16_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_U32_ENABLED
+        case U32:
+            return U32_SerializeBit(p_value, p_field->u32_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_I32_ENABLED
+        case I32:
+            return I32_SerializeBit(p_value, p_field->i32_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_S32_ENABLED
+        case S32:
+            return S32_SerializeBit(p_value, p_field->s32_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_U64_ENABLED
+        case U64:
+            return U64_SerializeBit(p_value, p_field->u64_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_I64_ENABLED
+        case I64:
+            return I64_SerializeBit(p_value, p_field->i64_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_S64_ENABLED
+        case S64:
+            return S64_SerializeBit(p_value, p_field->s64_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_FLOAT_ENABLED
+        case FLOAT:
+            return Float_SerializeBit(p_value, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_DOUBLE_ENABLED
+        case DOUBLE:
+            return Double_SerializeBit(p_value, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_LEN_ENABLED
+        case LEN:
+            return Size_SerializeBit(p_value, p_field->len_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+            return Array_SerializeBit(p_value, p_field->array_fixed_f.len, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+            return U16_SerializeBit(p_value, 16, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+            return U32_SerializeBit(p_value, 32, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+            return U8_SerializeBit(p_value, 8, p_stream);
+        #endif
+
+        default:
+            UNREACHABLE();
+            return ERROR_FIELD_TYPE_UNKNOWN;
+    }
+}
+
+Status_T BitParser_DeserializeValue(const BitField_T * p_field, void * p_value, Stream_T * p_stream) {
+    ASSERT_HOT(p_field != NULL);
+    ASSERT_HOT(p_value != NULL);
+    ASSERT_HOT(p_stream != NULL);
+
+    if(p_field->order != BIT_ORDER_STREAM)
+        return DeserializeOrdered(p_field, p_value, p_stream);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_U8_ENABLED
+        case U8:
+            return U8_DeserializeBit(p_value, p_field->u8_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_I8_ENABLED
+        case I8:
+            return I8_DeserializeBit(p_value, p_field->i8_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_S8_ENABLED
+        case S8:
+            return S8_DeserializeBit(p_value, p_field->s8_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_U16_ENABLED
+        case U16:
+            return U16_DeserializeBit(p_value, p_field->u16_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_I16_ENABLED
+        case I16:
+            return I16_DeserializeBit(p_value, p_field->i16_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_S16_ENABLED
+        case S16:
+            return S16_DeserializeBit(p_value, p_field->s16_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_U32_ENABLED
+        case U32:
+            return U32_DeserializeBit(p_value, p_field->u32_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_I32_ENABLED
+        case I32:
+            return I32_DeserializeBit(p_value, p_field->i32_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_S32_ENABLED
+        case S32:
+            return S32_DeserializeBit(p_value, p_field->s32_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_U64_ENABLED
+        case U64:
+            return U64_DeserializeBit(p_value, p_field->u64_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_I64_ENABLED
+        case I64:
+            return I64_DeserializeBit(p_value, p_field->i64_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_S64_ENABLED
+        case S64:
+            return S64_DeserializeBit(p_value, p_field->s64_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_FLOAT_ENABLED
+        case FLOAT:
+            return Float_DeserializeBit(p_value, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_DOUBLE_ENABLED
+        case DOUBLE:
+            return Double_DeserializeBit(p_value, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_LEN_ENABLED
+        case LEN:
+            return Size_DeserializeBit(p_value, p_field->len_f.bit, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+            return Array_DeserializeBit(p_value, p_field->array_fixed_f.len, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+            return U16_DeserializeBit(p_value, 16, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+            return U32_DeserializeBit(p_value, 32, p_stream);
+        #endif
+
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+            return U8_DeserializeBit(p_value, 8, p_stream);
+        #endif
+
+        default:
+            UNREACHABLE();
+            return ERROR_FIELD_TYPE_UNKNOWN;
+    }
+}
+
+size_t BitParser_GetFieldOffset(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_U8_ENABLED
+        case U8:
+            return p_field->u8_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_I8_ENABLED
+        case I8:
+            return p_field->i8_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_S8_ENABLED
+        case S8:
+            return p_field->s8_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_U16_ENABLED
+        case U16:
+            return p_field->u16_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_I16_ENABLED
+        case I16:
+            return p_field->i16_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_S16_ENABLED
+        case S16:
+            return p_field->s16_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_U32_ENABLED
+        case U32:
+            return p_field->u32_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_I32_ENABLED
+        case I32:
+            return p_field->i32_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_S32_ENABLED
+        case S32:
+            return p_field->s32_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_U64_ENABLED
+        case U64:
+            return p_field->u64_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_I64_ENABLED
+        case I64:
+            return p_field->i64_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_S64_ENABLED
+        case S64:
+            return p_field->s64_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_FLOAT_ENABLED
+        case FLOAT:
+            return p_field->float_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_DOUBLE_ENABLED
+        case DOUBLE:
+            return p_field->double_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_LEN_ENABLED
+        case LEN:
+            return p_field->len_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+            return p_field->array_fixed_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
+        case ARRAY_VARIABLE:
+            return p_field->array_variable_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+        case ARRAY_VARIABLE_WHOLE_MSG:
+            return p_field->array_variable_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_SUBMSG_ENABLED
+        case SUBMSG:
+            return p_field->submsg_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_UNION_ENABLED
+        case UNION:
+            return p_field->union_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_REPEATED_ENABLED
+        case REPEATED:
+            return p_field->repeated_f.offset;
+        #endif
+
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+        #endif
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+        #endif
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+        #endif
+        #if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED) || defined(BIT_FIELD_SUM8_ENABLED)
+            return p_field->checksum_f.offset;
+        #endif
+
+        default:
+            ASSERT(false);
+            return 0;
+    }
+}
+
+size_t BitParser_GetValueSize(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_U8_ENABLED
+        case U8:
+            return sizeof(uint8_t);
+        #endif
+
+        #ifdef BIT_FIELD_I8_ENABLED
+        case I8:
+            return sizeof(int8_t);
+        #endif
+
+        #ifdef BIT_FIELD_S8_ENABLED
+        case S8:
+            return sizeof(int8_t);
+        #endif
+
+        #ifdef BIT_FIELD_U16_ENABLED
+        case U16:
+            return sizeof(uint16_t);
+        #endif
+
+        #ifdef BIT_FIELD_I16_ENABLED
+        case I16:
+            return sizeof(int16_t);
+        #endif
+
+        #ifdef BIT_FIELD_S16_ENABLED
+        case S16:
+            return sizeof(int16_t);
+        #endif
+
+        #ifdef BIT_FIELD_U32_ENABLED
+        case U32:
+            return sizeof(uint32_t);
+        #endif
+
+        #ifdef BIT_FIELD_I32_ENABLED
+        case I32:
+            return sizeof(int32_t);
+        #endif
+
+        #ifdef BIT_FIELD_S32_ENABLED
+        case S32:
+            return sizeof(int32_t);
+        #endif
+
+        #ifdef BIT_FIELD_U64_ENABLED
+        case U64:
+            return sizeof(uint64_t);
+        #endif
+
+        #ifdef BIT_FIELD_I64_ENABLED
+        case I64:
+            return sizeof(int64_t);
+        #endif
+
+        #ifdef BIT_FIELD_S64_ENABLED
+        case S64:
+            return sizeof(int64_t);
+        #endif
+
+        #ifdef BIT_FIELD_FLOAT_ENABLED
+        case FLOAT:
+            return sizeof(float);
+        #endif
+
+        #ifdef BIT_FIELD_DOUBLE_ENABLED
+        case DOUBLE:
+            return sizeof(double);
+        #endif
+
+        #ifdef BIT_FIELD_LEN_ENABLED
+        case LEN:
+            return sizeof(size_t);
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+            return p_field->array_fixed_f.len;
+        #endif
+
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+            return sizeof(uint16_t);
+        #endif
+
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+            return sizeof(uint32_t);
+        #endif
+
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+            return sizeof(uint8_t);
+        #endif
+
+        default:
+            ASSERT(false);
+            return 0;
+    }
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static Status_T SerializeMessage(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                 BitError_T * p_error) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+
+    size_t              i = 0;
+    Stream_Checkpoint_T checkpoint;
+    Stream_T            frame;
+
+    Stream_Checkpoint(p_stream, &checkpoint);
+    Stream_OpenFrame(&frame, p_stream, Stream_TellBit(p_stream));
+
+    Status_T result = SerializeFields(p_fields, 0, no_fields, data, &frame, &i);
+
+    Stream_CloseFrame(p_stream, &frame);
+
+    if(result != STATUS_SUCCESS) {
+        if(p_error != NULL)
+            FillError(p_error, p_fields, i, data, p_stream, result, true);
+        Stream_Restore(p_stream, &checkpoint);
+    }
+
+    return result;
+}
+
+static Status_T SerializeFields(const BitField_T * p_fields, size_t first, size_t no_fields, void * data,
+                                Stream_T * p_stream, size_t * p_index) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_index != NULL);
+
+    for(size_t i = first; i < no_fields; i++) {
+        size_t no_native = GetNativeRun(&p_fields[i], no_fields - i, p_stream);
+        if(no_native != 0) {
+            ProcessNativeRun(&p_fields[i], no_native, data, p_stream, true);
+            i += no_native - 1;
+            continue;
+        }
+
+        #ifdef BIT_FIELD_LEN_ENABLED
+        if(p_fields[i].field_type == LEN && p_fields[i].len_f.is_auto)
+            return SerializeAutoLen(p_fields, i, no_fields, data, p_stream, p_index);
+        #endif
+
+        Status_T result;
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+        if(p_fields[i].field_type == ARRAY_VARIABLE_WHOLE_MSG) {
+            result = ProcessWholeMsg(p_fields, i, data, p_stream, true, NULL);
+            if(result != STATUS_SUCCESS) {
+                (*p_index) = i;
+                return result;
+            }
+
+            continue;
+        }
+        #endif
+
+        result = BitParser_SerializeField(&p_fields[i], data, p_stream);
+        if(result != STATUS_SUCCESS) {
+            (*p_index) = i;
+            return result;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static Status_T DeserializeMessage(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                   BitArena_T * p_arena, BitError_T * p_error) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+
+    Status_T result    = STATUS_SUCCESS;
+    size_t   i;
+    size_t   bit_index = Stream_TellBit(p_stream);
+    size_t   used      = p_arena != NULL ? BitArena_GetUsed(p_arena) : 0;
+    Stream_T frame;
+
+    Stream_OpenFrame(&frame, p_stream, bit_index);
+
+    for(i = 0; i < no_fields; i++) {
+        size_t no_native = GetNativeRun(&p_fields[i], no_fields - i, &frame);
+        if(no_native != 0) {
+            ProcessNativeRun(&p_fields[i], no_native, data, &frame, false);
+            i += no_native - 1;
+            continue;
+        }
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+        if(p_fields[i].field_type == ARRAY_VARIABLE_WHOLE_MSG) {
+            result = ProcessWholeMsg(p_fields, i, data, &frame, false, p_arena);
+            if(result != STATUS_SUCCESS)
+                break;
+
+            continue;
+        }
+        #endif
+
+        result = p_arena != NULL ? DeserializeArenaField(&p_fields[i], data, &frame, p_arena)
+                                 : BitParser_DeserializeField(&p_fields[i], data, &frame);
+        if(result != STATUS_SUCCESS)
+            break;
+    }
+
+    Stream_CloseFrame(p_stream, &frame);
+
+    if(result != STATUS_SUCCESS) {
+        if(p_error != NULL)
+            FillError(p_error, p_fields, i, data, p_stream, result, false);
+        Stream_SeekBit(p_stream, bit_index);
+        if(p_arena != NULL)
+            BitArena_Rewind(p_arena, used);
+    }
+
+    return result;
+}
+
+static void FillError(BitError_T * p_error, const BitField_T * p_fields, size_t index, void * data,
+                      Stream_T * p_stream, Status_T status, bool serialize) {
+    ASSERT(p_error != NULL);
+    ASSERT(p_fields != NULL);
+    ASSERT(p_stream != NULL);
+
+    p_error->status         = status;
+    p_error->field_index    = index;
+    p_error->field_type     = p_fields[index].field_type;
+    p_error->bit_offset     = Stream_TellBit(p_stream);
+    p_error->bits_needed    = 0;
+    p_error->bits_available = Stream_GetLeftBits(p_stream);
+
+    if(status != ERROR_STREAM_TOO_SHORT)
+        return;
+
+    #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+    if(p_fields[index].field_type == ARRAY_VARIABLE_WHOLE_MSG) {
+        size_t len;
+        if(GetWholeMsgLength(p_fields, index, data, serialize, &len) == STATUS_SUCCESS)
+            p_error->bits_needed = len * BITS_IN_BYTE;
+
+        return;
+    }
+    #endif
+
+    p_error->bits_needed = BitParser_GetFieldLengthBit(&p_fields[index], data, p_error->bit_offset);
+}
+
+static Status_T DeserializeArenaField(const BitField_T * p_field, void * data, Stream_T * p_stream,
+                                      BitArena_T * p_arena) {
+    ASSERT(p_field != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_arena != NULL);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
+        case ARRAY_VARIABLE: {
+            size_t len = *((size_t *) (data + p_field->array_variable_f.len_offset));
+            if(Stream_GetLeftBits(p_stream) < len * BITS_IN_BYTE)
+                return ERROR_STREAM_TOO_SHORT;
+
+            uint8_t * p_data = BitArena_Alloc(p_arena, len, 1);
+            if(p_data == NULL)
+                return ERROR_BUFFER_TOO_SHORT;
+
+            *((uint8_t **) (data + p_field->array_variable_f.offset)) = p_data;
+            return Array_DeserializeBit(p_data, len, p_stream);
+        }
+        #endif
+
+        #ifdef BIT_FIELD_SUBMSG_ENABLED
+        case SUBMSG:
+            return DeserializeMessage(p_field->submsg_f.p_fields, p_field->submsg_f.no_fields,
+                                      data + p_field->submsg_f.offset, p_stream, p_arena, NULL);
+        #endif
+
+        #ifdef BIT_FIELD_UNION_ENABLED
+        case UNION: {
+            const BitUnionCase_T * p_case = BitParser_FindUnionCase(p_field, GetUnionTag(p_field, data));
+            if(p_case == NULL)
+                return ERROR_UNION_TAG_UNKNOWN;
+
+            return DeserializeMessage(p_case->p_fields, p_case->no_fields, data + p_field->union_f.offset, p_stream,
+                                      p_arena, NULL);
+        }
+        #endif
+
+        #ifdef BIT_FIELD_REPEATED_ENABLED
+        case REPEATED:
+            return ProcessRepeated(p_field, data, p_stream, false, p_arena);
+        #endif
+
+        default:
+            return BitParser_DeserializeField(p_field, data, p_stream);
+    }
+}
+
+static Status_T SerializeAutoLen(const BitField_T * p_fields, size_t index, size_t no_fields, void * data,
+                                 Stream_T * p_stream, size_t * p_index) {
+    ASSERT(p_fields != NULL);
+    ASSERT(index < no_fields);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_index != NULL);
+
+    const BitField_T * p_field = &p_fields[index];
+    size_t             width   = p_field->len_f.bit;
+    Stream_T           len     = *p_stream;
+
+    (*p_index) = index;
+    Status_T result = Stream_SeekBit(p_stream, Stream_TellBit(p_stream) + width);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    size_t start = Stream_TellBit(p_stream);
+    result = SerializeFields(p_fields, index + 1, no_fields, data, p_stream, p_index);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    (*p_index) = index;
+    size_t bit   = Stream_TellBit(p_stream) - start;
+    size_t value = bit / BITS_IN_BYTE + (bit % BITS_IN_BYTE != 0 ? 1 : 0);
+    if(width < sizeof(size_t) * BITS_IN_BYTE && (value >> width) != 0)
+        return ERROR_DESCRIPTOR_INVALID;
+
+    *(size_t*)(data + p_field->len_f.offset) = value;
+    result = BitParser_SerializeValue(p_field, &value, &len);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    size_t changed = Stream_Tell(&len) + (Stream_TellBitInByte(&len) != 0 ? 1 : 0);
+    return RefreshChecksums(p_fields, index, no_fields, data, p_stream, start, changed, p_index);
+}
+
+static Status_T RefreshChecksums(const BitField_T * p_fields, size_t index, size_t no_fields, void * data,
+                                 Stream_T * p_stream, size_t bit_index, size_t changed, size_t * p_index) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_index != NULL);
+
+    Stream_T stream = *p_stream;
+    #if !defined(BIT_FIELD_CRC16_ENABLED) && !defined(BIT_FIELD_CRC32_ENABLED) && !defined(BIT_FIELD_SUM8_ENABLED)
+    (void) stream;
+    (void) changed;
+    #endif
+
+    for(size_t i = index + 1; i < no_fields; i++) {
+        switch(p_fields[i].field_type) {
+            #ifdef BIT_FIELD_CRC16_ENABLED
+            case CRC16:
+            #endif
+            #ifdef BIT_FIELD_CRC32_ENABLED
+            case CRC32:
+            #endif
+            #ifdef BIT_FIELD_SUM8_ENABLED
+            case SUM8:
+            #endif
+            #if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED) || defined(BIT_FIELD_SUM8_ENABLED)
+                if(p_fields[i].checksum_f.start < changed) {
+                    Status_T result = Stream_SeekBit(&stream, bit_index);
+                    if(result == STATUS_SUCCESS)
+                        result = BitParser_SerializeField(&p_fields[i], data, &stream);
+                    if(result != STATUS_SUCCESS) {
+                        (*p_index) = i;
+                        return result;
+                    }
+
+                    changed = Stream_Tell(&stream);
+                }
+                break;
+            #endif
+
+            default:
+                break;
+        }
+
+        bit_index += BitParser_GetMessageFieldLengthBit(p_fields, i, data, bit_index);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static Status_T GetWholeMsgLength(const BitField_T * p_fields, size_t index, void * data, bool serialize,
+                                  size_t * p_len) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_len != NULL);
+
+    size_t len_offset = p_fields[index].array_variable_f.len_offset;
+
+    for(size_t i = index; i-- > 0;) {
+        if(p_fields[i].field_type != LEN || p_fields[i].len_f.offset != len_offset)
+            continue;
+
+        size_t len = *((size_t *) (data + len_offset));
+        if(serialize && p_fields[i].len_f.is_auto) {
+            (*p_len) = len;
+            return STATUS_SUCCESS;
+        }
+
+        size_t header = GetMessageLengthBit(&p_fields[i + 1], index - i - 1, data, 0);
+        if(header % BITS_IN_BYTE != 0)
+            return ERROR_DESCRIPTOR_INVALID;
+
+        if(len < header / BITS_IN_BYTE)
+            return ERROR_STREAM_TOO_SHORT;
+
+        (*p_len) = len - header / BITS_IN_BYTE;
+        return STATUS_SUCCESS;
+    }
+
+    return ERROR_LEN_FIELD_MISSING;
+}
+
+static Status_T ProcessWholeMsg(const BitField_T * p_fields, size_t index, void * data, Stream_T * p_stream,
+                                bool serialize, BitArena_T * p_arena) {
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+
+    size_t   len;
+    Status_T result = GetWholeMsgLength(p_fields, index, data, serialize, &len);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    uint8_t ** pp_data = (uint8_t **) (data + p_fields[index].array_variable_f.offset);
+
+    if(serialize)
+        return Array_SerializeBit(*pp_data, len, p_stream);
+
+    if(Stream_TellBitInByte(p_stream) == 0) {
+        if(Stream_GetLeft(p_stream) < len)
+            return ERROR_STREAM_TOO_SHORT;
+
+        (*pp_data) = p_stream->p_buffer + Stream_Tell(p_stream);
+        return Stream_SeekBit(p_stream, Stream_TellBit(p_stream) + len * BITS_IN_BYTE);
+    }
+
+    if(p_arena != NULL) {
+        if(Stream_GetLeftBits(p_stream) < len * BITS_IN_BYTE)
+            return ERROR_STREAM_TOO_SHORT;
+
+        (*pp_data) = BitArena_Alloc(p_arena, len, 1);
+        if(*pp_data == NULL)
+            return ERROR_BUFFER_TOO_SHORT;
+    }
+
+    if(*pp_data == NULL)
+        return ERROR_STREAM_NOT_ALIGNED;
+
+    return Array_DeserializeBit(*pp_data, len, p_stream);
+}
+
+#if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED) || defined(BIT_FIELD_SUM8_ENABLED)
+static uint32_t CalculateChecksum(const BitField_T * p_field, const uint8_t * p_bytes, size_t len) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_bytes != NULL || len == 0);
+
+    uint32_t crc = p_field->checksum_f.init;
+
+    #ifdef BIT_FIELD_SUM8_ENABLED
+    if(p_field->field_type == SUM8) {
+        for(size_t i = 0; i < len; i++)
+            crc += p_bytes[i];
+
+        return (crc ^ p_field->checksum_f.xorout) & UINT8_MAX;
+    }
+    #endif
+
+    #if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED)
+    size_t           width = p_field->field_type == CRC16 ? 16 : 32;
+    uint32_t         mask  = width == 32 ? UINT32_MAX : (UINT32_C(1) << width) - 1;
+    uint32_t         scratch[16];
+    const uint32_t * table = GetCrcTable(p_field, width, scratch);
+
+    crc &= mask;
+    if(p_field->checksum_f.reflected) {
+        for(size_t i = 0; i < len; i++) {
+            crc ^= p_bytes[i];
+            crc  = (crc >> 4) ^ table[crc & 0xFu];
+            crc  = (crc >> 4) ^ table[crc & 0xFu];
+        }
+    }
+    else {
+        for(size_t i = 0; i < len; i++) {
+            crc ^= (uint32_t) p_bytes[i] << (width - 8);
+            crc  = ((crc << 4) & mask) ^ table[(crc >> (width - 4)) & 0xFu];
+            crc  = ((crc << 4) & mask) ^ table[(crc >> (width - 4)) & 0xFu];
+        }
+    }
+
+    return (crc ^ p_field->checksum_f.xorout) & mask;
+    #else
+    (void) p_bytes;
+    (void) len;
+    UNREACHABLE();
+    return crc;
+    #endif
+}
+
+static Status_T CalculateStreamChecksum(const BitField_T * p_field, Stream_T * p_stream, uint32_t * p_checksum) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_checksum != NULL);
+
+    if(Stream_TellBitInByte(p_stream) != 0)
+        return ERROR_STREAM_NOT_ALIGNED;
+
+    size_t start = p_field->checksum_f.start;
+    size_t end   = Stream_Tell(p_stream);
+    if(start > end)
+        return ERROR_DESCRIPTOR_INVALID;
+
+    (*p_checksum) = CalculateChecksum(p_field, p_stream->p_buffer + start, end - start);
+    return STATUS_SUCCESS;
+}
+
+static void StoreChecksum(const BitField_T * p_field, void * p_value, uint32_t checksum) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_value != NULL);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+            *(uint16_t*)p_value = (uint16_t) checksum;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+            *(uint32_t*)p_value = checksum;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+            *(uint8_t*)p_value = (uint8_t) checksum;
+            break;
+        #endif
+
+        default:
+            ASSERT(false);
+            break;
+    }
+}
+
+static uint32_t LoadChecksum(const BitField_T * p_field, const void * p_value) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_value != NULL);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+            return *(const uint16_t*)p_value;
+        #endif
+
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+            return *(const uint32_t*)p_value;
+        #endif
+
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+            return *(const uint8_t*)p_value;
+        #endif
+
+        default:
+            ASSERT(false);
+            return 0;
+    }
+}
+#endif
+
+#if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED)
+static const uint32_t * GetCrcTable(const BitField_T * p_field, size_t width, uint32_t * p_scratch) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_scratch != NULL);
+
+    uint32_t           mask      = width == 32 ? UINT32_MAX : (UINT32_C(1) << width) - 1;
+    uint32_t           poly      = p_field->checksum_f.poly & mask;
+    bool               reflected = p_field->checksum_f.reflected;
+    const CrcTable_T * p_tables  = NULL;
+    size_t             no_tables = 0;
+
+    #ifdef BIT_FIELD_CRC16_ENABLED
+    if(width == 16) {
+        p_tables  = crc16_tables;
+        no_tables = ARRAY_LEN(crc16_tables);
+    }
+    #endif
+
+    #ifdef BIT_FIELD_CRC32_ENABLED
+    if(width == 32) {
+        p_tables  = crc32_tables;
+        no_tables = ARRAY_LEN(crc32_tables);
+    }
+    #endif
+
+    for(size_t i = 0; i < no_tables; i++) {
+        if(p_tables[i].poly == poly && p_tables[i].reflected == reflected)
+            return p_tables[i].table;
+    }
+
+    if(reflected) {
+        uint32_t reflected_poly = 0;
+        for(size_t i = 0; i < width; i++)
+            reflected_poly |= ((poly >> i) & 1u) << (width - 1 - i);
+
+        for(uint32_t i = 0; i < 16; i++) {
+            uint32_t value = i;
+            for(size_t bit = 0; bit < 4; bit++)
+                value = (value & 1u) != 0 ? (value >> 1) ^ reflected_poly : value >> 1;
+            p_scratch[i] = value;
+        }
+    }
+    else {
+        for(uint32_t i = 0; i < 16; i++) {
+            uint32_t value = i << (width - 4);
+            for(size_t bit = 0; bit < 4; bit++)
+                value = ((value >> (width - 1)) & 1u) != 0 ? ((value << 1) ^ poly) & mask : (value << 1) & mask;
+            p_scratch[i] = value;
+        }
+    }
+
+    return p_scratch;
+}
+#endif
 
-    for(size_t i = 0; i < no_fields; i++) {
-        switch(p_fields[i].field_type) {
-            #ifdef BIT_FIELD_U8_ENABLED
-            case U8:
-                result = U8_SerializeBit(data + p_fields[i].u8_f.offset, p_fields[i].u8_f.bit, p_stream);
-                break;
-            #endif
+static Status_T SerializeOrdered(const BitField_T * p_field, void * p_value, Stream_T * p_stream) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_value != NULL);
+    ASSERT(p_stream != NULL);
 
-            #ifdef BIT_FIELD_I8_ENABLED
-            case I8:
-                result = I8_SerializeBit(data + p_fields[i].i8_f.offset, p_fields[i].i8_f.bit, p_stream);
-                break;
-            #endif
+    size_t bit = BitParser_GetFieldLengthBit(p_field, NULL, 0);
+    size_t len = bit / BITS_IN_BYTE;
+    ASSERT(bit % BITS_IN_BYTE == 0 && len <= sizeof(uint64_t));
+    ASSERT(p_field->order != BIT_ORDER_WORD_SWAPPED || len % sizeof(uint16_t) == 0);
 
-            #ifdef BIT_FIELD_S8_ENABLED
-            case S8:
-                result = S8_SerializeBit(data + p_fields[i].s8_f.offset, p_fields[i].s8_f.bit, p_stream);
-                break;
-            #endif
+    BitField_T field = *p_field;
+    field.order = BIT_ORDER_STREAM;
 
-            #ifdef BIT_FIELD_U16_ENABLED
-            case U16:
-                result = U16_SerializeBit(data + p_fields[i].u16_f.offset, p_fields[i].u16_f.bit, p_stream);
-                break;
-            #endif
+    uint8_t  bytes[sizeof(uint64_t)] = {0};
+    Stream_T stream;
+    Stream_Init(&stream, bytes, len, p_field->order == BIT_ORDER_LITTLE ? LITTLE : BIG);
 
-            #ifdef BIT_FIELD_I16_ENABLED
-            case I16:
-                result = I16_SerializeBit(data + p_fields[i].i16_f.offset, p_fields[i].i16_f.bit, p_stream);
-                break;
-            #endif
+    Status_T result = BitParser_SerializeValue(&field, p_value, &stream);
+    if(result != STATUS_SUCCESS)
+        return result;
 
-            #ifdef BIT_FIELD_S16_ENABLED
-            case S16:
-                result = S16_SerializeBit(data + p_fields[i].s16_f.offset, p_fields[i].s16_f.bit, p_stream);
-                break;
-            #endif
+    if(p_field->order == BIT_ORDER_WORD_SWAPPED)
+        SwapWords(bytes, len);
 
-            #ifdef BIT_FIELD_U32_ENABLED
-            case U32:
-                result = U32_SerializeBit(data + p_fields[i].u32_f.offset, p_fields[i].u32_f.bit, p_stream);
-                break;
-            #endif
+    uint64_t raw = LoadBytes(bytes, len, Stream_GetMode(p_stream));
+    return U64_SerializeBit(&raw, bit, p_stream);
+}
 
-            #ifdef BIT_FIELD_I32_ENABLED
-            case I32:
-                result = I32_SerializeBit(data + p_fields[i].i32_f.offset, p_fields[i].i32_f.bit, p_stream);
-                break;
-            #endif
+static Status_T DeserializeOrdered(const BitField_T * p_field, void * p_value, Stream_T * p_stream) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_value != NULL);
+    ASSERT(p_stream != NULL);
 
-            #ifdef BIT_FIELD_S32_ENABLED
-            case S32:
-                result = S32_SerializeBit(data + p_fields[i].s32_f.offset, p_fields[i].s32_f.bit, p_stream);
-                break;
-            #endif
+    size_t bit = BitParser_GetFieldLengthBit(p_field, NULL, 0);
+    size_t len = bit / BITS_IN_BYTE;
+    ASSERT(bit % BITS_IN_BYTE == 0 && len <= sizeof(uint64_t));
+    ASSERT(p_field->order != BIT_ORDER_WORD_SWAPPED || len % sizeof(uint16_t) == 0);
 
-            #ifdef BIT_FIELD_U64_ENABLED
-            case U64:
-                result = U64_SerializeBit(data + p_fields[i].u64_f.offset, p_fields[i].u64_f.bit, p_stream);
-                break;
-            #endif
+    uint64_t raw;
+    Status_T result = U64_DeserializeBit(&raw, bit, p_stream);
+    if(result != STATUS_SUCCESS)
+        return result;
 
-            #ifdef BIT_FIELD_I64_ENABLED
-            case I64:
-                result = I64_SerializeBit(data + p_fields[i].i64_f.offset, p_fields[i].i64_f.bit, p_stream);
-                break;
-            #endif
+    uint8_t bytes[sizeof(uint64_t)];
+    StoreBytes(bytes, raw, len, Stream_GetMode(p_stream));
 
-            #ifdef BIT_FIELD_S64_ENABLED
-            case S64:
-                result = S64_SerializeBit(data + p_fields[i].s64_f.offset, p_fields[i].s64_f.bit, p_stream);
-                break;
-            #endif
+    if(p_field->order == BIT_ORDER_WORD_SWAPPED)
+        SwapWords(bytes, len);
 
-            #ifdef BIT_FIELD_FLOAT_ENABLED
-            case FLOAT:
-                result = Float_SerializeBit(data + p_fields[i].float_f.offset, p_stream);
-                break;
-            #endif
+    BitField_T field = *p_field;
+    field.order = BIT_ORDER_STREAM;
 
-            #ifdef BIT_FIELD_DOUBLE_ENABLED
-            case DOUBLE:
-                result = Double_SerializeBit(data + p_fields[i].double_f.offset, p_stream);
-                break;
-            #endif
+    Stream_T stream;
+    Stream_Init(&stream, bytes, len, p_field->order == BIT_ORDER_LITTLE ? LITTLE : BIG);
+    return BitParser_DeserializeValue(&field, p_value, &stream);
+}
 
-            #ifdef BIT_FIELD_LEN_ENABLED
-            case LEN:
-                result = Size_SerializeBit(data + p_fields[i].len_f.offset, p_fields[i].len_f.bit, p_stream);
-                break;
-            #endif
+static void SwapWords(uint8_t * p_bytes, size_t len) {
+    ASSERT(p_bytes != NULL);
+    ASSERT(len % sizeof(uint16_t) == 0);
 
-            #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
-            case ARRAY_FIXED:
-                result = Array_SerializeBit(*((uint8_t **) (data + p_fields[i].array_fixed_f.offset)),
-                                             p_fields[i].array_fixed_f.len,
-                                             p_stream);
-                break;
-            #endif
+    for(size_t i = 0, j = len - sizeof(uint16_t); i < j; i += sizeof(uint16_t), j -= sizeof(uint16_t)) {
+        uint8_t high = p_bytes[i];
+        uint8_t low  = p_bytes[i + 1];
 
-            #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
-            case ARRAY_VARIABLE:
-                result = Array_SerializeBit(*((uint8_t **) (data + p_fields[i].array_variable_f.offset)),
-                                             *((size_t *) (data + p_fields[i].array_variable_f.len_offset)),
-                                             p_stream);
-                break;
-            #endif
+        p_bytes[i]     = p_bytes[j];
+        p_bytes[i + 1] = p_bytes[j + 1];
+        p_bytes[j]     = high;
+        p_bytes[j + 1] = low;
+    }
+}
 
-            #ifdef BIT_FIELD_ALIGN_ENABLED
-            case ALIGN:
-                Stream_Align(p_stream);
-                break;
-            #endif
+static size_t GetNativeSize(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    if(p_field->order == BIT_ORDER_WORD_SWAPPED)
+        return 0;
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_U8_ENABLED
+        case U8:
+            return p_field->u8_f.bit == sizeof(uint8_t) * BITS_IN_BYTE ? sizeof(uint8_t) : 0;
+        #endif
+
+        #ifdef BIT_FIELD_I8_ENABLED
+        case I8:
+            return p_field->i8_f.bit == sizeof(int8_t) * BITS_IN_BYTE ? sizeof(int8_t) : 0;
+        #endif
+
+        #ifdef BIT_FIELD_U16_ENABLED
+        case U16:
+            return p_field->u16_f.bit == sizeof(uint16_t) * BITS_IN_BYTE ? sizeof(uint16_t) : 0;
+        #endif
+
+        #ifdef BIT_FIELD_I16_ENABLED
+        case I16:
+            return p_field->i16_f.bit == sizeof(int16_t) * BITS_IN_BYTE ? sizeof(int16_t) : 0;
+        #endif
+
+        #ifdef BIT_FIELD_U32_ENABLED
+        case U32:
+            return p_field->u32_f.bit == sizeof(uint32_t) * BITS_IN_BYTE ? sizeof(uint32_t) : 0;
+        #endif
+
+        #ifdef BIT_FIELD_I32_ENABLED
+        case I32:
+            return p_field->i32_f.bit == sizeof(int32_t) * BITS_IN_BYTE ? sizeof(int32_t) : 0;
+        #endif
+
+        #ifdef BIT_FIELD_U64_ENABLED
+        case U64:
+            return p_field->u64_f.bit == sizeof(uint64_t) * BITS_IN_BYTE ? sizeof(uint64_t) : 0;
+        #endif
+
+        #ifdef BIT_FIELD_I64_ENABLED
+        case I64:
+            return p_field->i64_f.bit == sizeof(int64_t) * BITS_IN_BYTE ? sizeof(int64_t) : 0;
+        #endif
+
+        default:
+            return 0;
+    }
+}
 
-            #ifdef BIT_FIELD_PAD_ENABLED
-            case PAD:
-                result = Stream_SeekBit(p_stream, Stream_TellBit(p_stream) + p_fields[i].pad_f.bit);
-                break;
-            #endif
+static size_t GetNativeRun(const BitField_T * p_fields, size_t no_fields, Stream_T * p_stream) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_stream != NULL);
 
-            default:
-                ASSERT(false);
-        }
+    if(Stream_TellBitInByte(p_stream) != 0)
+        return 0;
 
-        if(result != STATUS_SUCCESS)
+    size_t left   = Stream_GetLeft(p_stream);
+    size_t len    = 0;
+    size_t result = 0;
+
+    while(result < no_fields) {
+        size_t size = GetNativeSize(&p_fields[result]);
+        if(size == 0 || len + size > left)
             break;
+
+        len += size;
+        result++;
     }
 
     return result;
 }
 
-Status_T BitParser_Deserialize(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream) {
+static void ProcessNativeRun(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                             bool serialize) {
     ASSERT(p_fields != NULL);
     ASSERT(data != NULL);
     ASSERT(p_stream != NULL);
 
-    Status_T result = STATUS_SUCCESS;
+    uint8_t *     p_bytes     = p_stream->p_buffer + Stream_Tell(p_stream);
+    Stream_Mode_T stream_mode = Stream_GetMode(p_stream);
 
     for(size_t i = 0; i < no_fields; i++) {
-        switch(p_fields[i].field_type) {
-            #ifdef BIT_FIELD_U8_ENABLED
-            case U8:
-                result = U8_DeserializeBit(data + p_fields[i].u8_f.offset, p_fields[i].u8_f.bit, p_stream);
+        void *        p_value = data + BitParser_GetFieldOffset(&p_fields[i]);
+        size_t        size    = GetNativeSize(&p_fields[i]);
+        Stream_Mode_T mode    = p_fields[i].order == BIT_ORDER_BIG    ? BIG
+                              : p_fields[i].order == BIT_ORDER_LITTLE ? LITTLE
+                                                                      : stream_mode;
+
+        switch(size) {
+            case sizeof(uint8_t):
+                if(serialize)
+                    p_bytes[0] = *(uint8_t*)p_value;
+                else
+                    *(uint8_t*)p_value = p_bytes[0];
                 break;
-            #endif
 
-            #ifdef BIT_FIELD_I8_ENABLED
-            case I8:
-                result = I8_DeserializeBit(data + p_fields[i].i8_f.offset, p_fields[i].i8_f.bit, p_stream);
+            case sizeof(uint16_t):
+                if(serialize)
+                    StoreBytes(p_bytes, *(uint16_t*)p_value, sizeof(uint16_t), mode);
+                else
+                    *(uint16_t*)p_value = (uint16_t) LoadBytes(p_bytes, sizeof(uint16_t), mode);
                 break;
-            #endif
 
-            #ifdef BIT_FIELD_S8_ENABLED
-            case S8:
-                result = S8_DeserializeBit(data + p_fields[i].s8_f.offset, p_fields[i].s8_f.bit, p_stream);
+            case sizeof(uint32_t):
+                if(serialize)
+                    StoreBytes(p_bytes, *(uint32_t*)p_value, sizeof(uint32_t), mode);
+                else
+                    *(uint32_t*)p_value = (uint32_t) LoadBytes(p_bytes, sizeof(uint32_t), mode);
                 break;
-            #endif
 
-            #ifdef BIT_FIELD_U16_ENABLED
-            case U16:
-                result = U16_DeserializeBit(data + p_fields[i].u16_f.offset, p_fields[i].u16_f.bit, p_stream);
+            case sizeof(uint64_t):
+                if(serialize)
+                    StoreBytes(p_bytes, *(uint64_t*)p_value, sizeof(uint64_t), mode);
+                else
+                    *(uint64_t*)p_value = LoadBytes(p_bytes, sizeof(uint64_t), mode);
                 break;
-            #endif
 
-            #ifdef BIT_FIELD_I16_ENABLED
-            case I16:
-                result = I16_DeserializeBit(data + p_fields[i].i16_f.offset, p_fields[i].i16_f.bit, p_stream);
+            default:
+                ASSERT(false);
                 break;
-            #endif
+        }
 
-            #ifdef BIT_FIELD_S16_ENABLED
-            case S16:
-                result = S16_DeserializeBit(data + p_fields[i].s16_f.offset, p_fields[i].s16_f.bit, p_stream);
-                break;
-            #endif
+        p_bytes += size;
+    }
 
-            #ifdef BIT_FIELD_U32_ENABLED
-            case U32:
-                result = U32_DeserializeBit(data + p_fields[i].u32_f.offset, p_fields[i].u32_f.bit, p_stream);
-                break;
-            #endif
+    Stream_SeekBit(p_stream, (size_t) (p_bytes - p_stream->p_buffer) * BITS_IN_BYTE);
+}
 
-            #ifdef BIT_FIELD_I32_ENABLED
-            case I32:
-                result = I32_DeserializeBit(data + p_fields[i].i32_f.offset, p_fields[i].i32_f.bit, p_stream);
-                break;
-            #endif
+static inline uint64_t LoadBytes(const uint8_t * p_bytes, size_t size, Stream_Mode_T mode) {
+    uint64_t result = 0;
 
-            #ifdef BIT_FIELD_S32_ENABLED
-            case S32:
-                result = S32_DeserializeBit(data + p_fields[i].s32_f.offset, p_fields[i].s32_f.bit, p_stream);
-                break;
-            #endif
+    for(size_t i = 0; i < size; i++)
+        result |= (uint64_t) p_bytes[mode == BIG ? size - 1 - i : i] << (i * BITS_IN_BYTE);
 
-            #ifdef BIT_FIELD_U64_ENABLED
-            case U64:
-                result = U64_DeserializeBit(data + p_fields[i].u64_f.offset, p_fields[i].u64_f.bit, p_stream);
-                break;
-            #endif
+    return result;
+}
 
-            #ifdef BIT_FIELD_I64_ENABLED
-            case I64:
-                result = I64_DeserializeBit(data + p_fields[i].i64_f.offset, p_fields[i].i64_f.bit, p_stream);
-                break;
-            #endif
+static inline void StoreBytes(uint8_t * p_bytes, uint64_t value, size_t size, Stream_Mode_T mode) {
+    for(size_t i = 0; i < size; i++)
+        p_bytes[mode == BIG ? size - 1 - i : i] = (uint8_t) (value >> (i * BITS_IN_BYTE));
+}
 
-            #ifdef BIT_FIELD_S64_ENABLED
-            case S64:
-                result = S64_DeserializeBit(data + p_fields[i].s64_f.offset, p_fields[i].s64_f.bit, p_stream);
-                break;
-            #endif
+static size_t GetMessageLengthBit(const BitField_T * p_fields, size_t no_fields, void * data, size_t bit_index) {
+    ASSERT(p_fields != NULL);
 
-            #ifdef BIT_FIELD_FLOAT_ENABLED
-            case FLOAT:
-                result = Float_DeserializeBit(data + p_fields[i].float_f.offset, p_stream);
-                break;
-            #endif
+    size_t result = 0;
+    for(size_t i = 0; i < no_fields; i++)
+        result = AddSaturated(result, BitParser_GetMessageFieldLengthBit(p_fields, i, data, bit_index + result));
 
-            #ifdef BIT_FIELD_DOUBLE_ENABLED
-            case DOUBLE:
-                result = Double_DeserializeBit(data + p_fields[i].double_f.offset, p_stream);
-                break;
-            #endif
+    return result;
+}
 
-            #ifdef BIT_FIELD_LEN_ENABLED
-            case LEN:
-                result = Size_DeserializeBit(data + p_fields[i].len_f.offset, p_fields[i].len_f.bit, p_stream);
-                break;
-            #endif
+static inline size_t AddSaturated(size_t a, size_t b) {
+    return a > SIZE_MAX - b ? SIZE_MAX : a + b;
+}
 
-            #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
-            case ARRAY_FIXED:
-                result = Array_DeserializeBit(*((uint8_t **) (data + p_fields[i].array_fixed_f.offset)),
-                                               p_fields[i].array_fixed_f.len,
-                                               p_stream);
-                break;
-            #endif
+static inline size_t MulSaturated(size_t a, size_t b) {
+    return b != 0 && a > SIZE_MAX / b ? SIZE_MAX : a * b;
+}
 
-            #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
-            case ARRAY_VARIABLE:
-                result = Array_DeserializeBit(*((uint8_t **) (data + p_fields[i].array_variable_f.offset)),
-                                               *((size_t *) (data + p_fields[i].array_variable_f.len_offset)),
-                                               p_stream);
-                break;
-            #endif
+static bool GetFixedLengthBit(const BitField_T * p_fields, size_t no_fields, size_t * p_bit) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_bit != NULL);
 
-            #ifdef BIT_FIELD_ALIGN_ENABLED
+    size_t result = 0;
+    for(size_t i = 0; i < no_fields; i++) {
+        switch(p_fields[i].field_type) {
+            case ARRAY_VARIABLE:
+            case ARRAY_VARIABLE_WHOLE_MSG:
             case ALIGN:
-                Stream_Align(p_stream);
-                break;
-            #endif
+            case UNION:
+            case REPEATED:
+                return false;
+
+            #ifdef BIT_FIELD_SUBMSG_ENABLED
+            case SUBMSG: {
+                size_t bit;
+                if(!GetFixedLengthBit(p_fields[i].submsg_f.p_fields, p_fields[i].submsg_f.no_fields, &bit))
+                    return false;
 
-            #ifdef BIT_FIELD_PAD_ENABLED
-            case PAD:
-                result = Stream_SeekBit(p_stream, Stream_TellBit(p_stream) + p_fields[i].pad_f.bit);
+                result += bit;
                 break;
+            }
             #endif
 
             default:
-                ASSERT(false);
+                result += BitParser_GetFieldLengthBit(&p_fields[i], NULL, result);
+                break;
         }
+    }
+
+    (*p_bit) = result;
+    return true;
+}
+
+static Status_T ProcessRepeated(const BitField_T * p_field, void * data, Stream_T * p_stream, bool serialize,
+                                BitArena_T * p_arena) {
+    ASSERT(p_field != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+
+    const BitField_T * p_fields  = p_field->repeated_f.p_fields;
+    size_t             no_fields = p_field->repeated_f.no_fields;
+    size_t             stride    = p_field->repeated_f.stride;
+    size_t             count     = *(size_t*)(data + p_field->repeated_f.count_offset);
+    uint8_t *          p_items   = *(uint8_t**)(data + p_field->repeated_f.offset);
+    size_t             item_bit;
+
+    if(GetFixedLengthBit(p_fields, no_fields, &item_bit) && item_bit != 0 &&
+       count > Stream_GetLeftBits(p_stream) / item_bit)
+        return ERROR_STREAM_TOO_SHORT;
 
+    if(p_arena != NULL) {
+        if(count > SIZE_MAX / stride)
+            return ERROR_BUFFER_TOO_SHORT;
+
+        /* Item alignment is not known, but it divides the item size. */
+        size_t align = stride & (~stride + 1);
+        p_items = BitArena_Alloc(p_arena, count * stride, MIN(align, _Alignof(max_align_t)));
+        if(p_items == NULL)
+            return ERROR_BUFFER_TOO_SHORT;
+
+        *(uint8_t**)(data + p_field->repeated_f.offset) = p_items;
+    }
+
+    ASSERT(count == 0 || p_items != NULL);
+
+    for(size_t i = 0; i < count; i++) {
+        void *   p_item = p_items + i * stride;
+        Status_T result = serialize ? BitParser_Serialize(p_fields, no_fields, p_item, p_stream)
+                                    : DeserializeMessage(p_fields, no_fields, p_item, p_stream, p_arena, NULL);
         if(result != STATUS_SUCCESS)
-            break;
+            return result;
     }
 
-    return result;
+    return STATUS_SUCCESS;
 }
 
-size_t BitParser_GetLengthBit(const BitField_T * p_fields, size_t no_fields, void * data)  {
-    ASSERT(p_fields != NULL);
+static bool IsVariableLength(const BitField_T * p_field, bool known_index) {
+    ASSERT(p_field != NULL);
 
-    size_t result = 0;
+    switch(p_field->field_type) {
+        case ARRAY_VARIABLE:
+        case ARRAY_VARIABLE_WHOLE_MSG:
+        case UNION:
+        case REPEATED:
+            return true;
 
-    for(size_t i = 0; i < no_fields; i++) {
-        switch(p_fields[i].field_type) {
-            #ifdef BIT_FIELD_U8_ENABLED
-            case U8:
-                result += p_fields[i].u8_f.bit;
-                break;
-            #endif
+        case ALIGN:
+            return !known_index;
 
-            #ifdef BIT_FIELD_I8_ENABLED
-            case I8:
-                result += p_fields[i].i8_f.bit;
-                break;
-            #endif
+        #ifdef BIT_FIELD_SUBMSG_ENABLED
+        case SUBMSG: {
+            size_t bit;
+            return !GetFixedLengthBit(p_field->submsg_f.p_fields, p_field->submsg_f.no_fields, &bit);
+        }
+        #endif
 
-            #ifdef BIT_FIELD_S8_ENABLED
-            case S8:
-                result += p_fields[i].s8_f.bit;
-                break;
-            #endif
+        default:
+            return false;
+    }
+}
 
-            #ifdef BIT_FIELD_U16_ENABLED
-            case U16:
-                result += p_fields[i].u16_f.bit;
-                break;
-            #endif
+static uint64_t GetUnionTag(const BitField_T * p_field, void * data) {
+    ASSERT(p_field != NULL);
+    ASSERT(data != NULL);
 
-            #ifdef BIT_FIELD_I16_ENABLED
-            case I16:
-                result += p_fields[i].i16_f.bit;
-                break;
-            #endif
+    void * p_tag = data + p_field->union_f.tag_offset;
 
-            #ifdef BIT_FIELD_S16_ENABLED
-            case S16:
-                result += p_fields[i].s16_f.bit;
-                break;
-            #endif
+    switch(p_field->union_f.tag_size) {
+        case sizeof(uint8_t):
+            return *(uint8_t*)p_tag;
 
-            #ifdef BIT_FIELD_U32_ENABLED
-            case U32:
-                result += p_fields[i].u32_f.bit;
-                break;
-            #endif
+        case sizeof(uint16_t):
+            return *(uint16_t*)p_tag;
 
-            #ifdef BIT_FIELD_I32_ENABLED
-            case I32:
-                result += p_fields[i].i32_f.bit;
-                break;
-            #endif
+        case sizeof(uint32_t):
+            return *(uint32_t*)p_tag;
 
-            #ifdef BIT_FIELD_S32_ENABLED
-            case S32:
-                result += p_fields[i].s32_f.bit;
-                break;
-            #endif
+        case sizeof(uint64_t):
+            return *(uint64_t*)p_tag;
 
-            #ifdef BIT_FIELD_U64_ENABLED
-            case U64:
-                result += p_fields[i].u64_f.bit;
-                break;
-            #endif
+        default:
+            ASSERT(false);
+            return 0;
+    }
+}
 
-            #ifdef BIT_FIELD_I64_ENABLED
-            case I64:
-                result += p_fields[i].i64_f.bit;
-                break;
-            #endif
+static void MoveField(BitField_T * p_field, size_t offset) {
+    ASSERT(p_field != NULL);
 
-            #ifdef BIT_FIELD_S64_ENABLED
-            case S64:
-                result += p_fields[i].s64_f.bit;
-                break;
-            #endif
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_U8_ENABLED
+        case U8:
+            p_field->u8_f.offset += offset;
+            break;
+        #endif
 
-            #ifdef BIT_FIELD_FLOAT_ENABLED
-            case FLOAT:
-                result += sizeof(float);
-                break;
-            #endif
+        #ifdef BIT_FIELD_I8_ENABLED
+        case I8:
+            p_field->i8_f.offset += offset;
+            break;
+        #endif
 
-            #ifdef BIT_FIELD_DOUBLE_ENABLED
-            case DOUBLE:
-                result += sizeof(double);
-                break;
-            #endif
+        #ifdef BIT_FIELD_S8_ENABLED
+        case S8:
+            p_field->s8_f.offset += offset;
+            break;
+        #endif
 
-            #ifdef BIT_FIELD_LEN_ENABLED
-            case LEN:
-                result += p_fields[i].len_f.bit;
-                break;
-            #endif
+        #ifdef BIT_FIELD_U16_ENABLED
+        case U16:
+            p_field->u16_f.offset += offset;
+            break;
+        #endif
 
-            #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
-            case ARRAY_FIXED:
-                result += p_fields[i].array_fixed_f.len;
-                break;
-            #endif
+        #ifdef BIT_FIELD_I16_ENABLED
+        case I16:
+            p_field->i16_f.offset += offset;
+            break;
+        #endif
 
-            #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
-            case ARRAY_VARIABLE:
-                ASSERT(data != NULL);
-                result += *((size_t *) (data + p_fields[i].array_variable_f.len_offset)) * BITS_IN_BYTE;
-                break;
-            #endif
+        #ifdef BIT_FIELD_S16_ENABLED
+        case S16:
+            p_field->s16_f.offset += offset;
+            break;
+        #endif
 
-            #ifdef BIT_FIELD_ALIGN_ENABLED
-            case ALIGN:
-                result += BITS_IN_BYTE - (result % BITS_IN_BYTE);
-                break;
-            #endif
+        #ifdef BIT_FIELD_U32_ENABLED
+        case U32:
+            p_field->u32_f.offset += offset;
+            break;
+        #endif
 
-            #ifdef BIT_FIELD_PAD_ENABLED
-            case PAD:
-                result += p_fields[i].pad_f.bit;
-                break;
-            #endif
+        #ifdef BIT_FIELD_I32_ENABLED
+        case I32:
+            p_field->i32_f.offset += offset;
+            break;
+        #endif
 
-            default:
-                ASSERT(false);
+        #ifdef BIT_FIELD_S32_ENABLED
+        case S32:
+            p_field->s32_f.offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_U64_ENABLED
+        case U64:
+            p_field->u64_f.offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_I64_ENABLED
+        case I64:
+            p_field->i64_f.offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_S64_ENABLED
+        case S64:
+            p_field->s64_f.offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_FLOAT_ENABLED
+        case FLOAT:
+            p_field->float_f.offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_DOUBLE_ENABLED
+        case DOUBLE:
+            p_field->double_f.offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_LEN_ENABLED
+        case LEN:
+            p_field->len_f.offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+            p_field->array_fixed_f.offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
+        case ARRAY_VARIABLE:
+            p_field->array_variable_f.offset     += offset;
+            p_field->array_variable_f.len_offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+        case ARRAY_VARIABLE_WHOLE_MSG:
+            p_field->array_variable_f.offset     += offset;
+            p_field->array_variable_f.len_offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_SUBMSG_ENABLED
+        case SUBMSG:
+            p_field->submsg_f.offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_UNION_ENABLED
+        case UNION:
+            p_field->union_f.offset     += offset;
+            p_field->union_f.tag_offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_REPEATED_ENABLED
+        case REPEATED:
+            p_field->repeated_f.offset       += offset;
+            p_field->repeated_f.count_offset += offset;
+            break;
+        #endif
+
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+        #endif
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+        #endif
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+        #endif
+        #if defined(BIT_FIELD_CRC16_ENABLED) || defined(BIT_FIELD_CRC32_ENABLED) || defined(BIT_FIELD_SUM8_ENABLED)
+            p_field->checksum_f.offset += offset;
+            break;
+        #endif
+
+        default:
+            break;
+    }
+}
+
+static Status_T Flatten(const BitField_T * p_fields, size_t no_fields, size_t offset, BitField_T * p_output,
+                        size_t max_fields, size_t * p_no_output) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_output != NULL);
+    ASSERT(p_no_output != NULL);
+
+    for(size_t i = 0; i < no_fields; i++) {
+        #ifdef BIT_FIELD_SUBMSG_ENABLED
+        if(p_fields[i].field_type == SUBMSG) {
+            Status_T result = Flatten(p_fields[i].submsg_f.p_fields, p_fields[i].submsg_f.no_fields,
+                                      offset + p_fields[i].submsg_f.offset, p_output, max_fields, p_no_output);
+            if(result != STATUS_SUCCESS)
+                return result;
+
+            continue;
         }
+        #endif
+
+        if((*p_no_output) >= max_fields)
+            return ERROR_BUFFER_TOO_SHORT;
+
+        p_output[*p_no_output] = p_fields[i];
+        MoveField(&p_output[*p_no_output], offset);
+        (*p_no_output)++;
     }
 
-    return result;
+    return STATUS_SUCCESS;
 }
 
-size_t BitParser_GetLength(const BitField_T * p_fields, size_t no_fields, void * data) {
+static bool HasLenBefore(const BitField_T * p_fields, size_t index, size_t offset) {
     ASSERT(p_fields != NULL);
 
-    size_t bit = BitParser_GetLengthBit(p_fields, no_fields, data);
-    return bit / BITS_IN_BYTE + (bit % BITS_IN_BYTE != 0 ? 1 : 0);
+    for(size_t i = 0; i < index; i++) {
+        if(p_fields[i].field_type == LEN && p_fields[i].len_f.offset == offset)
+            return true;
+    }
+
+    return false;
+}
+
+static Status_T ValidateField(const BitField_T * p_fields, size_t index) {
+    ASSERT(p_fields != NULL);
+
+    const BitField_T * p_field = &p_fields[index];
+
+    if(p_field->order > BIT_ORDER_WORD_SWAPPED)
+        return ERROR_DESCRIPTOR_INVALID;
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_U8_ENABLED
+        case U8:
+        #endif
+        #ifdef BIT_FIELD_I8_ENABLED
+        case I8:
+        #endif
+        #ifdef BIT_FIELD_S8_ENABLED
+        case S8:
+        #endif
+        #ifdef BIT_FIELD_U16_ENABLED
+        case U16:
+        #endif
+        #ifdef BIT_FIELD_I16_ENABLED
+        case I16:
+        #endif
+        #ifdef BIT_FIELD_S16_ENABLED
+        case S16:
+        #endif
+        #ifdef BIT_FIELD_U32_ENABLED
+        case U32:
+        #endif
+        #ifdef BIT_FIELD_I32_ENABLED
+        case I32:
+        #endif
+        #ifdef BIT_FIELD_S32_ENABLED
+        case S32:
+        #endif
+        #ifdef BIT_FIELD_U64_ENABLED
+        case U64:
+        #endif
+        #ifdef BIT_FIELD_I64_ENABLED
+        case I64:
+        #endif
+        #ifdef BIT_FIELD_S64_ENABLED
+        case S64:
+        #endif
+        #ifdef BIT_FIELD_FLOAT_ENABLED
+        case FLOAT:
+        #endif
+        #ifdef BIT_FIELD_DOUBLE_ENABLED
+        case DOUBLE:
+        #endif
+        {
+            size_t bit = BitParser_GetFieldLengthBit(p_field, NULL, 0);
+
+            if(bit == 0 || bit > BitParser_GetValueSize(p_field) * BITS_IN_BYTE)
+                return ERROR_FIELD_WIDTH_INVALID;
+            if(p_field->order != BIT_ORDER_STREAM && bit % BITS_IN_BYTE != 0)
+                return ERROR_FIELD_WIDTH_INVALID;
+            if(p_field->order == BIT_ORDER_WORD_SWAPPED && bit % (2 * BITS_IN_BYTE) != 0)
+                return ERROR_FIELD_WIDTH_INVALID;
+
+            return STATUS_SUCCESS;
+        }
+
+        #ifdef BIT_FIELD_LEN_ENABLED
+        case LEN:
+            if(p_field->len_f.bit == 0 || p_field->len_f.bit > sizeof(size_t) * BITS_IN_BYTE)
+                return ERROR_FIELD_WIDTH_INVALID;
+
+            return p_field->order == BIT_ORDER_STREAM ? STATUS_SUCCESS : ERROR_DESCRIPTOR_INVALID;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+            return STATUS_SUCCESS;
+        #endif
+
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_ENABLED
+        case ARRAY_VARIABLE:
+        #endif
+        #ifdef BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+        case ARRAY_VARIABLE_WHOLE_MSG:
+        #endif
+            return HasLenBefore(p_fields, index, p_field->array_variable_f.len_offset) ? STATUS_SUCCESS
+                                                                                      : ERROR_LEN_FIELD_MISSING;
+
+        #ifdef BIT_FIELD_ALIGN_ENABLED
+        case ALIGN:
+            return STATUS_SUCCESS;
+        #endif
+
+        #ifdef BIT_FIELD_PAD_ENABLED
+        case PAD:
+            return STATUS_SUCCESS;
+        #endif
+
+        #ifdef BIT_FIELD_SUBMSG_ENABLED
+        case SUBMSG:
+            return BitParser_Validate(p_field->submsg_f.p_fields, p_field->submsg_f.no_fields);
+        #endif
+
+        #ifdef BIT_FIELD_UNION_ENABLED
+        case UNION: {
+            size_t tag_size = p_field->union_f.tag_size;
+            if(tag_size != sizeof(uint8_t) && tag_size != sizeof(uint16_t) && tag_size != sizeof(uint32_t) &&
+               tag_size != sizeof(uint64_t))
+                return ERROR_DESCRIPTOR_INVALID;
+
+            for(size_t i = 0; i < p_field->union_f.no_cases; i++) {
+                const BitUnionCase_T * p_case = &p_field->union_f.p_cases[i];
+
+                Status_T result = BitParser_Validate(p_case->p_fields, p_case->no_fields);
+                if(result != STATUS_SUCCESS)
+                    return result;
+            }
+
+            return STATUS_SUCCESS;
+        }
+        #endif
+
+        #ifdef BIT_FIELD_REPEATED_ENABLED
+        case REPEATED:
+            if(p_field->repeated_f.stride == 0)
+                return ERROR_DESCRIPTOR_INVALID;
+            if(!HasLenBefore(p_fields, index, p_field->repeated_f.count_offset))
+                return ERROR_LEN_FIELD_MISSING;
+
+            return BitParser_Validate(p_field->repeated_f.p_fields, p_field->repeated_f.no_fields);
+        #endif
+
+        #ifdef BIT_FIELD_CRC16_ENABLED
+        case CRC16:
+        #endif
+        #ifdef BIT_FIELD_CRC32_ENABLED
+        case CRC32:
+        #endif
+        #ifdef BIT_FIELD_SUM8_ENABLED
+        case SUM8:
+        #endif
+            return p_field->order == BIT_ORDER_STREAM ? STATUS_SUCCESS : ERROR_DESCRIPTOR_INVALID;
+
+        default:
+            return ERROR_FIELD_TYPE_UNKNOWN;
+    }
+}
+
+static bool IsColumnField(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    switch(p_field->field_type) {
+        #ifdef BIT_FIELD_U8_ENABLED
+        case U8:
+        #endif
+        #ifdef BIT_FIELD_I8_ENABLED
+        case I8:
+        #endif
+        #ifdef BIT_FIELD_S8_ENABLED
+        case S8:
+        #endif
+        #ifdef BIT_FIELD_U16_ENABLED
+        case U16:
+        #endif
+        #ifdef BIT_FIELD_I16_ENABLED
+        case I16:
+        #endif
+        #ifdef BIT_FIELD_S16_ENABLED
+        case S16:
+        #endif
+        #ifdef BIT_FIELD_U32_ENABLED
+        case U32:
+        #endif
+        #ifdef BIT_FIELD_I32_ENABLED
+        case I32:
+        #endif
+        #ifdef BIT_FIELD_S32_ENABLED
+        case S32:
+        #endif
+        #ifdef BIT_FIELD_U64_ENABLED
+        case U64:
+        #endif
+        #ifdef BIT_FIELD_I64_ENABLED
+        case I64:
+        #endif
+        #ifdef BIT_FIELD_S64_ENABLED
+        case S64:
+        #endif
+        #ifdef BIT_FIELD_FLOAT_ENABLED
+        case FLOAT:
+        #endif
+        #ifdef BIT_FIELD_DOUBLE_ENABLED
+        case DOUBLE:
+        #endif
+        #ifdef BIT_FIELD_LEN_ENABLED
+        case LEN:
+        #endif
+        #ifdef BIT_FIELD_ARRAY_FIXED_ENABLED
+        case ARRAY_FIXED:
+        #endif
+        #ifdef BIT_FIELD_ALIGN_ENABLED
+        case ALIGN:
+        #endif
+        #ifdef BIT_FIELD_PAD_ENABLED
+        case PAD:
+        #endif
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static bool IsUnionTag(const BitField_T * p_fields, size_t no_fields, size_t index) {
+    ASSERT(p_fields != NULL);
+
+    #ifdef BIT_FIELD_UNION_ENABLED
+    for(size_t i = index + 1; i < no_fields; i++) {
+        if(p_fields[i].field_type == UNION && BitParser_FindUnionTag(p_fields, i) == index)
+            return true;
+    }
+    #else
+    (void) no_fields;
+    (void) index;
+    #endif
+
+    return false;
 }
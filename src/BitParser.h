@@ -35,28 +35,70 @@ extern "C" {
 #include <stdbool.h>
 
 #include "Stream.h"
+#include "BitArena.h"
 #include "BitParserError.h"
+#include "BitParserConfig.h"
 
-#define BIT_FIELD_U8(width, type, field) {.field_type = U8, .u8_f = {.offset = offsetof(type, field), .bit = (width)}}
-#define BIT_FIELD_I8(width, type, field) {.field_type = I8, .i8_f = {.offset = offsetof(type, field), .bit = (width)}}
-#define BIT_FIELD_S8(width, type, field) {.field_type = S8, .s8_f = {.offset = offsetof(type, field), .bit = (width)}}
+#ifndef BIT_PARSER_BIT_API_ENABLED
+#error "BitParser requires the bit-level UParser API, define BIT_PARSER_BIT_API_ENABLED"
+#endif
+
+/*
+ * Compile time checks of descriptor macros. Widths and byte orders shall be constant expressions, a field
+ * wider than its value type, of zero width, or with byte order override and width not a multiple of 8 bits,
+ * as well as struct member of other size than the value type, fail to compile. Checks are not available
+ * in C++.
+ */
+#ifdef __cplusplus
+#define BIT_FIELD_CHECK(cond) 0
+#else
+#define BIT_FIELD_CHECK(cond) (0 * sizeof(struct { int bit_field_check_failed : (cond) ? 1 : -1; }))
+#endif
+
+#define BIT_FIELD_SIZE(type, field, value_type) BIT_FIELD_CHECK(sizeof(((type *) 0)->field) == sizeof(value_type))
+#define BIT_FIELD_WIDTH(width, type, field, value_type) \
+    ((width) + BIT_FIELD_SIZE(type, field, value_type) + \
+     BIT_FIELD_CHECK((width) > 0 && (width) <= sizeof(value_type) * BITS_IN_BYTE))
+#define BIT_FIELD_ORDER_WIDTH(width, type, field, value_type, _order) \
+    (BIT_FIELD_WIDTH(width, type, field, value_type) + \
+     BIT_FIELD_CHECK((_order) == BIT_ORDER_STREAM || (width) % BITS_IN_BYTE == 0))
 
-#define BIT_FIELD_U16(width, type, field) {.field_type = U16, .u16_f = {.offset = offsetof(type, field), .bit = (width)}}
-#define BIT_FIELD_I16(width, type, field) {.field_type = I16, .i16_f = {.offset = offsetof(type, field), .bit = (width)}}
-#define BIT_FIELD_S16(width, type, field) {.field_type = S16, .s16_f = {.offset = offsetof(type, field), .bit = (width)}}
+#define BIT_FIELD_U8(width, type, field) {.field_type = U8, .u8_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, uint8_t)}}
+#define BIT_FIELD_I8(width, type, field) {.field_type = I8, .i8_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, int8_t)}}
+#define BIT_FIELD_S8(width, type, field) {.field_type = S8, .s8_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, int8_t)}}
 
-#define BIT_FIELD_U32(width, type, field) {.field_type = U32, .u32_f = {.offset = offsetof(type, field), .bit = (width)}}
-#define BIT_FIELD_I32(width, type, field) {.field_type = I32, .i32_f = {.offset = offsetof(type, field), .bit = (width)}}
-#define BIT_FIELD_S32(width, type, field) {.field_type = S32, .s32_f = {.offset = offsetof(type, field), .bit = (width)}}
+#define BIT_FIELD_U16(width, type, field) {.field_type = U16, .u16_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, uint16_t)}}
+#define BIT_FIELD_I16(width, type, field) {.field_type = I16, .i16_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, int16_t)}}
+#define BIT_FIELD_S16(width, type, field) {.field_type = S16, .s16_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, int16_t)}}
 
-#define BIT_FIELD_U64(width, type, field) {.field_type = U64LE, .u64_f = {.offset = offsetof(type, field), .bit = (width)}}
-#define BIT_FIELD_I64(width, type, field) {.field_type = I64LE, .i64_f = {.offset = offsetof(type, field), .bit = (width)}}
-#define BIT_FIELD_S64(width, type, field) {.field_type = S64LE, .s64_f = {.offset = offsetof(type, field), .bit = (width)}}
+#define BIT_FIELD_U32(width, type, field) {.field_type = U32, .u32_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, uint32_t)}}
+#define BIT_FIELD_I32(width, type, field) {.field_type = I32, .i32_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, int32_t)}}
+#define BIT_FIELD_S32(width, type, field) {.field_type = S32, .s32_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, int32_t)}}
 
-#define BIT_FIELD_FLOAT(type, field)  {.field_type = FLOAT, . float_f  = {.offset = offsetof(type, field)}}
-#define BIT_FIELD_DOUBLE(type, field) {.field_type = DOUBLE, .double_f = {.offset = offsetof(type, field)}}
+#define BIT_FIELD_U64(width, type, field) {.field_type = U64, .u64_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, uint64_t)}}
+#define BIT_FIELD_I64(width, type, field) {.field_type = I64, .i64_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, int64_t)}}
+#define BIT_FIELD_S64(width, type, field) {.field_type = S64, .s64_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, int64_t)}}
 
-#define BIT_FIELD_LEN(width, type, field) {.field_type = LEN, .len_f = {.offset = offsetof(type, field), .bit = (width)}}
+#define BIT_FIELD_FLOAT(type, field)  {.field_type = FLOAT, . float_f  = {.offset = offsetof(type, field) + BIT_FIELD_SIZE(type, field, float)}}
+#define BIT_FIELD_DOUBLE(type, field) {.field_type = DOUBLE, .double_f = {.offset = offsetof(type, field) + BIT_FIELD_SIZE(type, field, double)}}
+
+#define BIT_FIELD_U16_ORDER(width, type, field, _order) {.field_type = U16, .order = (_order), .u16_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_ORDER_WIDTH(width, type, field, uint16_t, _order)}}
+#define BIT_FIELD_I16_ORDER(width, type, field, _order) {.field_type = I16, .order = (_order), .i16_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_ORDER_WIDTH(width, type, field, int16_t, _order)}}
+#define BIT_FIELD_S16_ORDER(width, type, field, _order) {.field_type = S16, .order = (_order), .s16_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_ORDER_WIDTH(width, type, field, int16_t, _order)}}
+
+#define BIT_FIELD_U32_ORDER(width, type, field, _order) {.field_type = U32, .order = (_order), .u32_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_ORDER_WIDTH(width, type, field, uint32_t, _order)}}
+#define BIT_FIELD_I32_ORDER(width, type, field, _order) {.field_type = I32, .order = (_order), .i32_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_ORDER_WIDTH(width, type, field, int32_t, _order)}}
+#define BIT_FIELD_S32_ORDER(width, type, field, _order) {.field_type = S32, .order = (_order), .s32_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_ORDER_WIDTH(width, type, field, int32_t, _order)}}
+
+#define BIT_FIELD_U64_ORDER(width, type, field, _order) {.field_type = U64, .order = (_order), .u64_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_ORDER_WIDTH(width, type, field, uint64_t, _order)}}
+#define BIT_FIELD_I64_ORDER(width, type, field, _order) {.field_type = I64, .order = (_order), .i64_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_ORDER_WIDTH(width, type, field, int64_t, _order)}}
+#define BIT_FIELD_S64_ORDER(width, type, field, _order) {.field_type = S64, .order = (_order), .s64_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_ORDER_WIDTH(width, type, field, int64_t, _order)}}
+
+#define BIT_FIELD_FLOAT_ORDER(type, field, _order)  {.field_type = FLOAT, .order = (_order), .float_f  = {.offset = offsetof(type, field) + BIT_FIELD_SIZE(type, field, float)}}
+#define BIT_FIELD_DOUBLE_ORDER(type, field, _order) {.field_type = DOUBLE, .order = (_order), .double_f = {.offset = offsetof(type, field) + BIT_FIELD_SIZE(type, field, double)}}
+
+#define BIT_FIELD_LEN(width, type, field) {.field_type = LEN, .len_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, size_t)}}
+#define BIT_FIELD_LEN_AUTO(width, type, field) {.field_type = LEN, .len_f = {.offset = offsetof(type, field), .bit = BIT_FIELD_WIDTH(width, type, field, size_t), .is_auto = true}}
 
 #define BIT_FIELD_ARRAY_FIXED(_len, type, field)    {.field_type = ARRAY_FIXED,    .array_fixed_f    = {.offset = offsetof(type, field), .len = (_len)}}
 #define BIT_FIELD_ARRAY_VARIABLE(type, field, _len) {.field_type = ARRAY_VARIABLE, .array_variable_f = {.offset = offsetof(type, field), .len_offset = (offsetof(type, _len))}}
@@ -65,25 +107,17 @@ extern "C" {
 #define BIT_FIELD_ALIGN()    {.field_type = ALIGN}
 #define BIT_FIELD_PAD(width) {.field_type = PAD, .pad_f = {.bit = width}}
 
-#define BIT_FIELD_U8_ENABLED
-#define BIT_FIELD_I8_ENABLED
-#define BIT_FIELD_S8_ENABLED
-#define BIT_FIELD_U16_ENABLED
-#define BIT_FIELD_I16_ENABLED
-#define BIT_FIELD_S16_ENABLED
-#define BIT_FIELD_U32_ENABLED
-#define BIT_FIELD_I32_ENABLED
-#define BIT_FIELD_S32_ENABLED
-#define BIT_FIELD_U64_ENABLED
-#define BIT_FIELD_I64_ENABLED
-#define BIT_FIELD_S64_ENABLED
-#define BIT_FIELD_FLOAT_ENABLED
-#define BIT_FIELD_DOUBLE_ENABLED
-#define BIT_FIELD_LEN_ENABLED
-#define BIT_FIELD_ARRAY_FIXED_ENABLED
-#define BIT_FIELD_ARRAY_VARIABLE_ENABLED
-#define BIT_FIELD_ALIGN_ENABLED
-#define BIT_FIELD_PAD_ENABLED
+#define BIT_FIELD_SUBMSG(type, field, desc) {.field_type = SUBMSG, .submsg_f = {.offset = offsetof(type, field), .p_fields = (desc), .no_fields = ARRAY_LEN(desc)}}
+#define BIT_FIELD_UNION(type, field, tag, cases) {.field_type = UNION, .union_f = {.offset = offsetof(type, field), .tag_offset = offsetof(type, tag), .tag_size = sizeof(((type *) 0)->tag), .p_cases = (cases), .no_cases = ARRAY_LEN(cases)}}
+#define BIT_FIELD_REPEATED(type, field, _count, desc) {.field_type = REPEATED, .repeated_f = {.offset = offsetof(type, field), .count_offset = offsetof(type, _count), .stride = sizeof(*((type *) 0)->field), .p_fields = (desc), .no_fields = ARRAY_LEN(desc)}}
+#define BIT_FIELD_CRC16(type, field, _start, _poly, _init, _xorout, _reflected) {.field_type = CRC16, .checksum_f = {.offset = offsetof(type, field), .start = (_start), .poly = (_poly), .init = (_init), .xorout = (_xorout), .reflected = (_reflected)}}
+#define BIT_FIELD_CRC32(type, field, _start, _poly, _init, _xorout, _reflected) {.field_type = CRC32, .checksum_f = {.offset = offsetof(type, field), .start = (_start), .poly = (_poly), .init = (_init), .xorout = (_xorout), .reflected = (_reflected)}}
+#define BIT_FIELD_SUM8(type, field, _start) {.field_type = SUM8, .checksum_f = {.offset = offsetof(type, field), .start = (_start)}}
+#define BIT_UNION_CASE(_tag, desc) {.tag = (_tag), .p_fields = (desc), .no_fields = ARRAY_LEN(desc)}
+
+#define BIT_PARSER_MASK_SIZE(no_fields)   (((no_fields) + BITS_IN_BYTE - 1) / BITS_IN_BYTE)
+#define BIT_PARSER_MASK_SET(p_mask, i)    ((p_mask)[(i) / BITS_IN_BYTE] |= (uint8_t) (1u << ((i) % BITS_IN_BYTE)))
+#define BIT_PARSER_MASK_IS_SET(p_mask, i) (((p_mask)[(i) / BITS_IN_BYTE] & (1u << ((i) % BITS_IN_BYTE))) != 0)
 
 /**
  * Field type.
@@ -106,16 +140,45 @@ typedef enum {
     LEN,                /*!< size_t field type. */
     ARRAY_FIXED,        /*!< array with fixed size field type. */
     ARRAY_VARIABLE,     /*!< array with variable size field type. */
-    ARRAY_VARIABLE_WHOLE_MSG,
+    ARRAY_VARIABLE_WHOLE_MSG, /*!< rest of message covered by preceding LEN field, array field type. */
     ALIGN,              /*!< stream align control field field type. */
     PAD,                /*!< pad control field type. */
+    SUBMSG,             /*!< nested message described by its own descriptor field type. */
+    UNION,              /*!< nested message with descriptor selected by a previously decoded tag field type. */
+    REPEATED,           /*!< array of nested messages with count given by LEN field type. */
+    CRC16,              /*!< uint16_t CRC of preceding bytes field type. */
+    CRC32,              /*!< uint32_t CRC of preceding bytes field type. */
+    SUM8,               /*!< uint8_t sum of preceding bytes field type. */
 } BitFieldType_T;
 
 /**
- * Bit field description struct
+ * Byte order of a field. Overrides byte order given by stream mode for a single field, stream state is
+ * not changed. Applies only to integer, float and double fields whose width is a multiple of 8 bits
+ * (16 bits for BIT_ORDER_WORD_SWAPPED). Bytes of a field not aligned to byte boundary are its
+ * consecutive 8 bit groups.
+ */
+typedef enum {
+    BIT_ORDER_STREAM = 0,       /*!< Byte order given by stream mode. */
+    BIT_ORDER_BIG,              /*!< Big endian, most significant byte first. */
+    BIT_ORDER_LITTLE,           /*!< Little endian, least significant byte first. */
+    BIT_ORDER_WORD_SWAPPED,     /*!< Big endian 16 bit words, least significant word first. */
+} BitOrder_T;
+
+/**
+ * Single case of UNION field, ie. body descriptor used when tag field has given value.
  */
 typedef struct {
+    uint64_t                  tag;        /*!< Tag value selecting this case. */
+    const struct BitField_S * p_fields;   /*!< Body descriptor. */
+    size_t                    no_fields;  /*!< Number of fields in body descriptor. */
+} BitUnionCase_T;
+
+/**
+ * Bit field description struct
+ */
+typedef struct BitField_S {
     BitFieldType_T field_type;
+    BitOrder_T     order;
     union {
         struct {
             size_t offset;
@@ -188,6 +251,7 @@ typedef struct {
         struct  {
             size_t offset;
             size_t bit;
+            bool   is_auto;
         } len_f;
 
         struct {
@@ -203,23 +267,137 @@ typedef struct {
         struct {
             size_t bit;
         } pad_f;
+
+        struct {
+            size_t                    offset;
+            const struct BitField_S * p_fields;
+            size_t                    no_fields;
+        } submsg_f;
+
+        struct {
+            size_t                 offset;
+            size_t                 tag_offset;
+            size_t                 tag_size;
+            const BitUnionCase_T * p_cases;
+            size_t                 no_cases;
+        } union_f;
+
+        struct {
+            size_t                    offset;
+            size_t                    count_offset;
+            size_t                    stride;
+            const struct BitField_S * p_fields;
+            size_t                    no_fields;
+        } repeated_f;
+
+        struct {
+            size_t   offset;
+            size_t   start;
+            uint32_t poly;
+            uint32_t init;
+            uint32_t xorout;
+            bool     reflected;
+        } checksum_f;
     };
 } BitField_T;
 
+/**
+ * Variable length field of a length profile.
+ */
+typedef struct {
+    size_t field;       /*!< Index of field in descriptor. */
+    size_t static_bit;  /*!< Length of fixed length fields between previous variable field and this one. */
+} BitLengthTerm_T;
+
+/**
+ * Precomputed length profile of a message descriptor.
+ *
+ * Lengths of fixed length fields are summed once at setup, so calculating length of a message costs
+ * only evaluation of its variable length fields, ie. O(1) for messages without them.
+ */
+typedef struct {
+    const BitField_T * p_fields;    /*!< Bit field message descriptor. */
+    BitLengthTerm_T *  p_terms;     /*!< Variable length fields. */
+    size_t             no_terms;    /*!< Number of variable length fields. */
+    size_t             static_bit;  /*!< Length of fixed length fields following the last variable one. */
+} BitLengthProfile_T;
+
+/**
+ * Batch of serialized records decoded into an array of message structs.
+ *
+ * Records are either fixed size, then record i starts at byte i * record_len, or their byte offsets
+ * are given by p_index, then record i spans from p_index[i] to p_index[i + 1] (or to the end of buffer
+ * for the last one).
+ */
+typedef struct {
+    uint8_t *      p_buffer;     /*!< Pointer to buffer with serialized records. */
+    size_t         len;          /*!< Buffer length in bytes. */
+    Stream_Mode_T  mode;         /*!< Stream mode of records. */
+    size_t         record_len;   /*!< Length of a single record in bytes. Used if p_index is NULL. */
+    const size_t * p_index;      /*!< Optional byte offsets of no_records records. */
+    size_t         no_records;   /*!< Number of records in buffer. */
+    void *         p_output;     /*!< Array of no_records message structs. */
+    size_t         output_size;  /*!< Size of a single message struct in bytes. */
+} BitBatch_T;
+
+/**
+ * Error context of a failed message serialization or deserialization. It is filled on failure path only,
+ * so passing it costs nothing when parsing succeeds. Failures inside SUBMSG, UNION and REPEATED fields are
+ * reported at the enclosing field of the top level descriptor.
+ */
+typedef struct {
+    Status_T       status;          /*!< Returned status. */
+    size_t         field_index;     /*!< Index of failed field in descriptor. */
+    BitFieldType_T field_type;      /*!< Type of failed field. */
+    size_t         bit_offset;      /*!< Stream bit index the failure was detected at, start of failed field for scalars. */
+    size_t         bits_needed;     /*!< Length of failed field in bits, set for ERROR_STREAM_TOO_SHORT only. */
+    size_t         bits_available;  /*!< Stream bits left at bit_offset. */
+} BitError_T;
+
 /**
  * Serialize struct using bit field message descriptor.
  *
+ * Automatic LEN fields (BIT_FIELD_LEN_AUTO) are not serialized from the struct. Their bits are reserved,
+ * the rest of the message is serialized and its length in bytes is back-patched into them and stored in
+ * the struct. Automatic LEN field shall not be the length of an ARRAY_VARIABLE field. When it covers an
+ * ARRAY_VARIABLE_WHOLE_MSG field, its struct member gives the array length on input and is replaced with
+ * the message length, as decoded by deserialization. Checksum fields covering automatic LEN field are
+ * calculated over its final value.
+ *
+ * Serialization is atomic. On failure stream is rolled back with Stream_Restore, so its position and
+ * the byte holding it are the same as before the call. Following bytes may hold partially written data.
+ *
  * @param p_fields      Bit field message descriptor.
  * @param no_fields     Number of fields in descriptor.
  * @param data          Structure to be serialized.
  * @param p_stream      Stream to write data.
- * @return              Status.
+ * @return              Status. ERROR_DESCRIPTOR_INVALID if automatic length does not fit its field.
  */
 Status_T BitParser_Serialize(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream);
 
+/**
+ * Serialize struct using bit field message descriptor, see BitParser_Serialize.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to be serialized.
+ * @param p_stream      Stream to write data.
+ * @param p_error       Optional error context, written only on failure. May be NULL.
+ * @return              Status.
+ */
+Status_T BitParser_SerializeEx(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                               BitError_T * p_error);
+
 /**
  * Deserialize stream into struct using bit field message descriptor.
  *
+ * ARRAY_VARIABLE_WHOLE_MSG field holds the rest of bytes covered by the LEN field it refers to, ie. LEN value
+ * minus bytes of fields between them, which shall be of fixed length. If the field is aligned to byte
+ * boundary it is not copied, its pointer is set into the stream buffer and stays valid as long as the
+ * buffer. Otherwise bytes are copied to the array it points to, ERROR_STREAM_NOT_ALIGNED if it is NULL.
+ *
+ * On failure stream position is restored to the start of the message, struct may be partially written.
+ *
  * @param p_fields      Bit field message descriptor.
  * @param no_fields     Number of fields in descriptor.
  * @param data          Structure to write data.
@@ -229,13 +407,271 @@ Status_T BitParser_Serialize(const BitField_T * p_fields, size_t no_fields, void
 Status_T BitParser_Deserialize(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream);
 
 /**
- * Calculate len of serialized message in bits.
+ * Deserialize stream into struct using bit field message descriptor, see BitParser_Deserialize.
  *
  * @param p_fields      Bit field message descriptor.
  * @param no_fields     Number of fields in descriptor.
- * @param data          Structure to be serialized.
+ * @param data          Structure to write data.
+ * @param p_stream      Stream to read data.
+ * @param p_error       Optional error context, written only on failure. May be NULL.
  * @return              Status.
  */
+Status_T BitParser_DeserializeEx(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                 BitError_T * p_error);
+
+/**
+ * Deserialize stream into struct, allocating variable length data from arena instead of writing it to
+ * arrays the struct points to. ARRAY_VARIABLE arrays, not aligned ARRAY_VARIABLE_WHOLE_MSG arrays and
+ * REPEATED items, also in nested messages, are carved from arena and struct pointers are set to them.
+ * On failure memory allocated by the call is released.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to write data.
+ * @param p_stream      Stream to read data.
+ * @param p_arena       Arena to allocate variable length data from.
+ * @return              Status. ERROR_BUFFER_TOO_SHORT if arena is exhausted.
+ */
+Status_T BitParser_DeserializeArena(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                    BitArena_T * p_arena);
+
+/**
+ * Deserialize stream into struct allocating from arena, see BitParser_DeserializeArena.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to write data.
+ * @param p_stream      Stream to read data.
+ * @param p_arena       Arena to allocate variable length data from.
+ * @param p_error       Optional error context, written only on failure. May be NULL.
+ * @return              Status.
+ */
+Status_T BitParser_DeserializeArenaEx(const BitField_T * p_fields, size_t no_fields, void * data, Stream_T * p_stream,
+                                      BitArena_T * p_arena, BitError_T * p_error);
+
+/**
+ * Deserialize only selected fields of a message. Field i is selected if bit i of the mask is set,
+ * see BIT_PARSER_MASK_SET. Unselected fields are not decoded nor written to the struct, stream index is
+ * just moved past them, with consecutive unselected fields folded into a single seek. LEN fields are
+ * always decoded, because lengths of variable arrays, selected or not, depend on them. SUBMSG, UNION
+ * and REPEATED fields are always decoded as a whole, since they may contain LEN fields or depend on a tag.
+ * Tag fields of UNION fields, see BitParser_FindUnionTag, are always decoded too.
+ *
+ * On failure stream position is restored to the start of the message, struct may be partially written.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param p_mask        Selected fields bitmap, BIT_PARSER_MASK_SIZE(no_fields) bytes.
+ * @param data          Structure to write data.
+ * @param p_stream      Stream to read data.
+ * @return              Status.
+ */
+Status_T BitParser_DeserializeSelected(const BitField_T * p_fields, size_t no_fields, const uint8_t * p_mask,
+                                       void * data, Stream_T * p_stream);
+
+/**
+ * Deserialize consecutive records from stream into columns, one column per descriptor field.
+ * Value of field i of record r is written to element r of p_columns[i], where element size is the size
+ * of field's value type (ie. uint16_t for U16, size_t for LEN). ARRAY_FIXED column is a contiguous
+ * byte array holding len bytes per record. ALIGN and PAD fields have no column, their entry may be NULL.
+ * Variable length, nested and checksum fields are not supported, descriptor holding any of them is rejected
+ * with ERROR_DESCRIPTOR_INVALID before anything is read.
+ *
+ * On failure stream position is restored to the start of the first record, columns may be partially written.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param p_columns     Array of no_fields column pointers.
+ * @param no_records    Number of records to read.
+ * @param p_stream      Stream to read data.
+ * @return              Status.
+ */
+Status_T BitParser_DeserializeColumns(const BitField_T * p_fields, size_t no_fields, void * const * p_columns,
+                                      size_t no_records, Stream_T * p_stream);
+
+/**
+ * Locate a single record of a batch.
+ *
+ * @param p_batch       Batch description.
+ * @param index         Index of record.
+ * @param pp_record     Output pointer to the first byte of record.
+ * @param p_len         Output record length in bytes.
+ * @return              Status. ERROR_STREAM_TOO_SHORT if record exceeds the buffer.
+ */
+Status_T BitParser_GetBatchRecord(const BitBatch_T * p_batch, size_t index, uint8_t ** pp_record, size_t * p_len);
+
+/**
+ * Deserialize count records of a batch starting from record first.
+ * Every record is read with its own stream, so disjoint ranges of one batch can be decoded concurrently.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param p_batch       Batch description.
+ * @param first         Index of the first record to decode.
+ * @param count         Number of records to decode.
+ * @return              Status.
+ */
+Status_T BitParser_DeserializeBatch(const BitField_T * p_fields, size_t no_fields, const BitBatch_T * p_batch,
+                                    size_t first, size_t count);
+
+/**
+ * Serialize single field of a message struct.
+ *
+ * Checksum fields (CRC16, CRC32, SUM8) cover stream bytes from byte start of checksum description up to the
+ * checksum field, which shall be byte aligned. Within a message, start counts from the byte holding the first
+ * bit of the message (or of the nested message the field belongs to), a single field counts it from the
+ * start of the stream. Serialization calculates checksum, stores it in the struct
+ * and writes it, deserialization reads it and verifies it. CRC polynomial is given in normal (not reversed)
+ * form, init is the initial register value, xorout is xored with the final register value and reflected
+ * selects bit reflected (LSB first) algorithm, eg. CRC-16/MODBUS is 0x8005, 0xFFFF, 0x0000, true.
+ *
+ * @param p_field       Bit field description.
+ * @param data          Structure to be serialized. May be NULL for ALIGN and PAD fields.
+ * @param p_stream      Stream to write data.
+ * @return              Status. ERROR_DESCRIPTOR_INVALID for ARRAY_VARIABLE_WHOLE_MSG fields, whose length
+ *                      depends on the rest of message.
+ */
+Status_T BitParser_SerializeField(const BitField_T * p_field, void * data, Stream_T * p_stream);
+
+/**
+ * Deserialize single field of a message struct.
+ *
+ * @param p_field       Bit field description.
+ * @param data          Structure to write data. May be NULL for ALIGN and PAD fields.
+ * @param p_stream      Stream to read data.
+ * @return              Status. ERROR_CHECKSUM_MISMATCH if checksum field does not match,
+ *                      ERROR_DESCRIPTOR_INVALID for ARRAY_VARIABLE_WHOLE_MSG fields.
+ */
+Status_T BitParser_DeserializeField(const BitField_T * p_field, void * data, Stream_T * p_stream);
+
+/**
+ * Serialize single value pointed by p_value. Only value field types are handled here, ie. integer,
+ * float, double, LEN and ARRAY_FIXED fields, which do not depend on other fields of a message.
+ * Checksum fields are written as plain values, without calculation.
+ * For ARRAY_FIXED p_value points to the array itself.
+ *
+ * @param p_field       Bit field description.
+ * @param p_value       Pointer to value of field's type.
+ * @param p_stream      Stream to write data.
+ * @return              Status.
+ */
+Status_T BitParser_SerializeValue(const BitField_T * p_field, void * p_value, Stream_T * p_stream);
+
+/**
+ * Deserialize single value into p_value. Counterpart of BitParser_SerializeValue. Checksum fields are read
+ * as plain values, without verification.
+ *
+ * @param p_field       Bit field description.
+ * @param p_value       Pointer to value of field's type.
+ * @param p_stream      Stream to read data.
+ * @return              Status.
+ */
+Status_T BitParser_DeserializeValue(const BitField_T * p_field, void * p_value, Stream_T * p_stream);
+
+/**
+ * Get offset of a field's value in a message struct.
+ *
+ * @param p_field       Bit field description. Shall not be ALIGN nor PAD field.
+ * @return              Offset in bytes.
+ */
+size_t BitParser_GetFieldOffset(const BitField_T * p_field);
+
+/**
+ * Get size of a field's value in memory, ie. size of the value type for integer, float, double and LEN
+ * fields and array length for ARRAY_FIXED fields.
+ *
+ * @param p_field       Bit field description.
+ * @return              Size in bytes.
+ */
+size_t BitParser_GetValueSize(const BitField_T * p_field);
+
+/**
+ * Find case of UNION field selected by tag value.
+ * Cases shall be sorted by tag. If case i has tag i, it is found by direct indexing, so tables of small
+ * dense tags cost O(1), sparse tags fall back to binary search.
+ *
+ * @param p_field       UNION field description.
+ * @param tag           Tag value.
+ * @return              Selected case or NULL if there is none.
+ */
+const BitUnionCase_T * BitParser_FindUnionCase(const BitField_T * p_field, uint64_t tag);
+
+/**
+ * Find field holding the tag of UNION field, ie. the last field preceding it whose value is at the tag
+ * offset of the union.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param index         Index of UNION field in descriptor.
+ * @return              Index of tag field or index if tag is not a field of the descriptor.
+ */
+size_t BitParser_FindUnionTag(const BitField_T * p_fields, size_t index);
+
+/**
+ * Calculate len of a single serialized field in bits, saturating at SIZE_MAX.
+ *
+ * Length of ARRAY_VARIABLE_WHOLE_MSG field depends on the rest of message, use
+ * BitParser_GetMessageFieldLengthBit for it.
+ *
+ * @param p_field       Bit field description.
+ * @param data          Structure to be serialized. Needed only for ARRAY_VARIABLE fields.
+ * @param bit_index     Stream bit index the field starts at. Needed only for ALIGN fields.
+ * @return              Field length in bits.
+ */
+size_t BitParser_GetFieldLengthBit(const BitField_T * p_field, void * data, size_t bit_index);
+
+/**
+ * Calculate len of a single serialized field of a message in bits, see BitParser_GetFieldLengthBit.
+ * Length of ARRAY_VARIABLE_WHOLE_MSG field is the value of its LEN field minus bytes of fields between
+ * them, 0 if it can not be calculated.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param index         Index of field in descriptor.
+ * @param data          Structure to be serialized. Needed only for ARRAY_VARIABLE and
+ *                      ARRAY_VARIABLE_WHOLE_MSG fields.
+ * @param bit_index     Stream bit index the field starts at. Needed only for ALIGN fields.
+ * @return              Field length in bits.
+ */
+size_t BitParser_GetMessageFieldLengthBit(const BitField_T * p_fields, size_t index, void * data, size_t bit_index);
+
+/**
+ * Flatten a descriptor, replacing SUBMSG fields with fields of their child descriptors, recursively.
+ * Struct offsets of inlined fields are adjusted, so the flat descriptor describes the same struct and
+ * the same serialized message without any nesting overhead. Intended to be called once at setup.
+ * Automatic LEN fields of child descriptors would cover the rest of the flat message, so descriptors
+ * containing them shall not be flattened.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param p_output      Output flat descriptor.
+ * @param max_fields    Size of output descriptor.
+ * @param p_no_output   Output number of fields in flat descriptor.
+ * @return              Status. ERROR_BUFFER_TOO_SHORT if output descriptor is too small.
+ */
+Status_T BitParser_Flatten(const BitField_T * p_fields, size_t no_fields, BitField_T * p_output, size_t max_fields,
+                           size_t * p_no_output);
+
+/**
+ * Validate a descriptor, recursively. Field types shall be known and enabled, widths shall fit value types,
+ * byte order overrides shall be used with widths of whole bytes (words for BIT_ORDER_WORD_SWAPPED) and
+ * ARRAY_VARIABLE, ARRAY_VARIABLE_WHOLE_MSG and REPEATED fields shall be preceded by their LEN fields.
+ * Descriptors used by a library built with BIT_PARSER_VALIDATED, and not built from BIT_FIELD_* macros
+ * only, shall be validated once at setup.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @return              Status. ERROR_FIELD_TYPE_UNKNOWN, ERROR_FIELD_WIDTH_INVALID, ERROR_LEN_FIELD_MISSING or
+ *                      ERROR_DESCRIPTOR_INVALID if descriptor is invalid.
+ */
+Status_T BitParser_Validate(const BitField_T * p_fields, size_t no_fields);
+
+/**
+ * Calculate len of serialized message in bits, saturating at SIZE_MAX, eg. for hostile LEN values.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure to be serialized.
+ * @return              Message length in bits.
+ */
 size_t BitParser_GetLengthBit(const BitField_T * p_fields, size_t no_fields, void * data);
 
 /**
@@ -244,10 +680,42 @@ size_t BitParser_GetLengthBit(const BitField_T * p_fields, size_t no_fields, voi
  * @param p_fields      Bit field message descriptor.
  * @param no_fields     Number of fields in descriptor.
  * @param data          Structure to be serialized.
- * @return              Status.
+ * @return              Message length in bytes.
  */
 size_t BitParser_GetLength(const BitField_T * p_fields, size_t no_fields, void * data);
 
+/**
+ * Initialize length profile of a message descriptor. Intended to be called once at setup.
+ * ALIGN fields preceded by a variable length field are treated as variable length, others are static.
+ *
+ * @param p_self        Length profile to initialize.
+ * @param p_fields      Bit field message descriptor. Shall outlive the profile.
+ * @param no_fields     Number of fields in descriptor.
+ * @param p_terms       Storage for variable length fields.
+ * @param max_terms     Size of terms storage.
+ * @return              Status. ERROR_BUFFER_TOO_SHORT if there are more than max_terms variable length fields.
+ */
+Status_T BitParser_InitLengthProfile(BitLengthProfile_T * p_self, const BitField_T * p_fields, size_t no_fields,
+                                     BitLengthTerm_T * p_terms, size_t max_terms);
+
+/**
+ * Calculate len of serialized message in bits using length profile, saturating at SIZE_MAX.
+ *
+ * @param p_self        Length profile.
+ * @param data          Structure to be serialized. May be NULL if profile has no variable length fields.
+ * @return              Message length in bits.
+ */
+size_t BitParser_GetProfileLengthBit(const BitLengthProfile_T * p_self, void * data);
+
+/**
+ * Calculate len of serialized message in bytes using length profile.
+ *
+ * @param p_self        Length profile.
+ * @param data          Structure to be serialized. May be NULL if profile has no variable length fields.
+ * @return              Message length in bytes.
+ */
+size_t BitParser_GetProfileLength(const BitLengthProfile_T * p_self, void * data);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,90 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_PARSER_CONFIG_H
+#define BIT_PARSER_CONFIG_H
+
+/*
+ * Build configuration.
+ *
+ * By default every field type, both stream modes and both UParser APIs are compiled in. Defining
+ * BIT_PARSER_CONFIG_FILE, ie. -DBIT_PARSER_CONFIG_FILE=\"bitparser_config.h\", replaces the default
+ * field type list with the one given in that file, so field types not listed there are not compiled.
+ * The file may also define:
+ *  - BIT_PARSER_MODE_BIG_ENABLED and/or BIT_PARSER_MODE_LITTLE_ENABLED, to compile only given stream modes,
+ *  - BIT_PARSER_BIT_API_ENABLED and/or BIT_PARSER_BYTE_API_ENABLED, to compile only given UParser API,
+ *  - BIT_PARSER_VALIDATED, to drop hot path checks (see BitParserError.h).
+ * When none of the modes or none of the APIs is defined, all of them are enabled.
+ *
+ * BitParser and the modules built on top of it use the bit-level API only, so a build without it contains
+ * Stream and UParser byte-level API only.
+ */
+#ifdef BIT_PARSER_CONFIG_FILE
+#include BIT_PARSER_CONFIG_FILE
+#else
+#define BIT_FIELD_U8_ENABLED
+#define BIT_FIELD_I8_ENABLED
+#define BIT_FIELD_S8_ENABLED
+#define BIT_FIELD_U16_ENABLED
+#define BIT_FIELD_I16_ENABLED
+#define BIT_FIELD_S16_ENABLED
+#define BIT_FIELD_U32_ENABLED
+#define BIT_FIELD_I32_ENABLED
+#define BIT_FIELD_S32_ENABLED
+#define BIT_FIELD_U64_ENABLED
+#define BIT_FIELD_I64_ENABLED
+#define BIT_FIELD_S64_ENABLED
+#define BIT_FIELD_FLOAT_ENABLED
+#define BIT_FIELD_DOUBLE_ENABLED
+#define BIT_FIELD_LEN_ENABLED
+#define BIT_FIELD_ARRAY_FIXED_ENABLED
+#define BIT_FIELD_ARRAY_VARIABLE_ENABLED
+#define BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED
+#define BIT_FIELD_ALIGN_ENABLED
+#define BIT_FIELD_PAD_ENABLED
+#define BIT_FIELD_SUBMSG_ENABLED
+#define BIT_FIELD_UNION_ENABLED
+#define BIT_FIELD_REPEATED_ENABLED
+#define BIT_FIELD_CRC16_ENABLED
+#define BIT_FIELD_CRC32_ENABLED
+#define BIT_FIELD_SUM8_ENABLED
+#endif
+
+#if !defined(BIT_PARSER_MODE_BIG_ENABLED) && !defined(BIT_PARSER_MODE_LITTLE_ENABLED)
+#define BIT_PARSER_MODE_BIG_ENABLED
+#define BIT_PARSER_MODE_LITTLE_ENABLED
+#endif
+
+#if !defined(BIT_PARSER_BIT_API_ENABLED) && !defined(BIT_PARSER_BYTE_API_ENABLED)
+#define BIT_PARSER_BIT_API_ENABLED
+#define BIT_PARSER_BYTE_API_ENABLED
+#endif
+
+#if (defined(BIT_FIELD_ARRAY_VARIABLE_ENABLED) || defined(BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG_ENABLED) || \
+     defined(BIT_FIELD_REPEATED_ENABLED)) && !defined(BIT_FIELD_LEN_ENABLED)
+#error "Variable length field types require BIT_FIELD_LEN_ENABLED"
+#endif
+
+#endif /* BIT_PARSER_CONFIG_H */
@@ -32,11 +32,37 @@ extern "C" {
 
 #include <assert.h>
 
+#include "BitParserConfig.h"
+
 #define ASSERT(x) assert(x)
 
-#define STATUS_SUCCESS           0
-#define ERROR_STREAM_NOT_ALIGNED 1
-#define ERROR_STREAM_TOO_SHORT   2
+/*
+ * Hot path checks of per-field functions, ie. argument checks and unknown field type defaults. Building
+ * with BIT_PARSER_VALIDATED drops them, then every descriptor shall be checked with BitParser_Validate
+ * or built with BIT_FIELD_* macros only, and no NULL arguments shall be passed.
+ */
+#ifdef BIT_PARSER_VALIDATED
+#define ASSERT_HOT(x) ((void) 0)
+#if defined(__GNUC__)
+#define UNREACHABLE() __builtin_unreachable()
+#else
+#define UNREACHABLE() ((void) 0)
+#endif
+#else
+#define ASSERT_HOT(x) ASSERT(x)
+#define UNREACHABLE() ASSERT(false)
+#endif
+
+#define STATUS_SUCCESS            0
+#define ERROR_STREAM_NOT_ALIGNED  1
+#define ERROR_STREAM_TOO_SHORT    2
+#define ERROR_DESCRIPTOR_INVALID  3
+#define ERROR_BUFFER_TOO_SHORT    4
+#define ERROR_UNION_TAG_UNKNOWN   5
+#define ERROR_CHECKSUM_MISMATCH   6
+#define ERROR_FIELD_TYPE_UNKNOWN  7
+#define ERROR_FIELD_WIDTH_INVALID 8
+#define ERROR_LEN_FIELD_MISSING   9
 
 typedef unsigned int Status_T;
 
@@ -0,0 +1,165 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include "BitPatch.h"
+#include "BitParserError.h"
+
+/**
+ * Check if length of serialized field is known without message content.
+ *
+ * @param p_field   Bit field description.
+ * @return          True if field has fixed length.
+ */
+static bool IsFixedLength(const BitField_T * p_field);
+
+/**
+ * Check if field is a checksum field.
+ *
+ * @param p_field   Bit field description.
+ * @return          True for CRC16, CRC32 and SUM8 fields.
+ */
+static bool IsChecksum(const BitField_T * p_field);
+
+/**
+ * Write single field of serialized message at given offset.
+ *
+ * @param p_self    Pointer to patcher object.
+ * @param index     Index of field in descriptor.
+ * @param data      Message struct.
+ * @param bit       Bit offset of field in stream.
+ * @return          Status.
+ */
+static Status_T WriteField(BitPatch_T * p_self, size_t index, void * data, size_t bit);
+
+void BitPatch_Init(BitPatch_T * p_self, const BitField_T * p_fields, size_t no_fields, Stream_T * p_stream,
+                   size_t * p_offsets) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_fields != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_offsets != NULL);
+
+    p_self->p_fields  = p_fields;
+    p_self->no_fields = no_fields;
+    p_self->stream    = *p_stream;
+    p_self->p_offsets = p_offsets;
+    p_self->no_fixed  = 0;
+
+    size_t bit = Stream_TellBit(p_stream);
+    p_offsets[0] = bit;
+
+    while(p_self->no_fixed < no_fields && IsFixedLength(&p_fields[p_self->no_fixed])) {
+        bit += BitParser_GetFieldLengthBit(&p_fields[p_self->no_fixed], NULL, bit);
+        p_self->no_fixed++;
+        p_offsets[p_self->no_fixed] = bit;
+    }
+}
+
+Status_T BitPatch_Field(BitPatch_T * p_self, size_t index, void * data) {
+    ASSERT(p_self != NULL);
+    ASSERT(index < p_self->no_fields);
+    ASSERT(data != NULL);
+
+    size_t   bit    = BitPatch_GetOffsetBit(p_self, index, data);
+    Status_T result = WriteField(p_self, index, data, bit);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    bit += BitParser_GetMessageFieldLengthBit(p_self->p_fields, index, data, bit);
+
+    size_t changed = bit;
+    for(size_t i = index + 1; i < p_self->no_fields; i++) {
+        const BitField_T * p_field = &p_self->p_fields[i];
+        size_t             next    = bit + BitParser_GetMessageFieldLengthBit(p_self->p_fields, i, data, bit);
+
+        if(IsChecksum(p_field) && p_self->p_offsets[0] + p_field->checksum_f.start * BITS_IN_BYTE < changed) {
+            result = WriteField(p_self, i, data, bit);
+            if(result != STATUS_SUCCESS)
+                return result;
+
+            changed = next;
+        }
+
+        bit = next;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+size_t BitPatch_GetOffsetBit(const BitPatch_T * p_self, size_t index, void * data) {
+    ASSERT(p_self != NULL);
+    ASSERT(index < p_self->no_fields);
+
+    if(index <= p_self->no_fixed)
+        return p_self->p_offsets[index];
+
+    ASSERT(data != NULL);
+
+    size_t bit = p_self->p_offsets[p_self->no_fixed];
+    for(size_t i = p_self->no_fixed; i < index; i++)
+        bit += BitParser_GetMessageFieldLengthBit(p_self->p_fields, i, data, bit);
+
+    return bit;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static bool IsFixedLength(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    switch(p_field->field_type) {
+        case ARRAY_VARIABLE:
+        case ARRAY_VARIABLE_WHOLE_MSG:
+        case SUBMSG:
+        case UNION:
+        case REPEATED:
+            return false;
+
+        default:
+            return true;
+    }
+}
+
+static bool IsChecksum(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    return p_field->field_type == CRC16 || p_field->field_type == CRC32 || p_field->field_type == SUM8;
+}
+
+static Status_T WriteField(BitPatch_T * p_self, size_t index, void * data, size_t bit) {
+    ASSERT(p_self != NULL);
+    ASSERT(data != NULL);
+
+    Stream_T stream = p_self->stream;
+    Status_T result = Stream_SeekBit(&stream, bit);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    Stream_T frame;
+    Stream_OpenFrame(&frame, &stream, p_self->p_offsets[0]);
+
+    return BitParser_SerializeField(&p_self->p_fields[index], data, &frame);
+}
@@ -0,0 +1,101 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_PATCH_H
+#define BIT_PATCH_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+/**
+ * Patcher of an already serialized message.
+ *
+ * Patcher rewrites bits of single fields in a serialized message, leaving the rest of the buffer intact.
+ * Bit offsets of fields preceding the first variable length field do not depend on message content,
+ * they are computed once at initialization and cached. Offsets of further fields are computed on every
+ * patch from the message struct. Patched fields shall keep their serialized length. Checksum fields
+ * following a patched field are recalculated if their range covers the patched field or another
+ * recalculated checksum, other checksum fields are left intact.
+ */
+typedef struct {
+    const BitField_T * p_fields;    /*!< Bit field message descriptor. */
+    size_t             no_fields;   /*!< Number of fields in descriptor. */
+    Stream_T           stream;      /*!< Stream over serialized message, at its first bit. */
+    size_t *           p_offsets;   /*!< Cached bit offsets of fixed offset fields. */
+    size_t             no_fixed;    /*!< Number of fields with fixed offset. */
+} BitPatch_T;
+
+/**
+ * Initialize patcher.
+ *
+ * @param p_self        Pointer to allocated patcher object.
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param p_stream      Stream over serialized message, at its first bit. Copied, original is not moved.
+ * @param p_offsets     Storage for no_fields + 1 bit offsets.
+ */
+void BitPatch_Init(BitPatch_T * p_self, const BitField_T * p_fields, size_t no_fields, Stream_T * p_stream,
+                   size_t * p_offsets);
+
+/**
+ * Rewrite single field of serialized message with its value from message struct.
+ *
+ * Lengths of all fields following the patched one are computed to locate checksum fields. Each
+ * recalculated checksum reads the whole range it covers, so patching costs O(range) rather than
+ * O(field) for messages protected by checksums.
+ *
+ * @param p_self        Pointer to patcher object.
+ * @param index         Index of field in descriptor.
+ * @param data          Message struct the message was serialized from, with new value of the field.
+ * @return              Status.
+ */
+Status_T BitPatch_Field(BitPatch_T * p_self, size_t index, void * data);
+
+/**
+ * Get bit offset of a field in serialized message.
+ *
+ * Offsets of fields following the first variable length field are not cached, lengths of fields
+ * preceding the given one are computed from the message struct on every call.
+ *
+ * @param p_self        Pointer to patcher object.
+ * @param index         Index of field in descriptor.
+ * @param data          Message struct the message was serialized from. Not used for fixed offset fields.
+ * @return              Bit offset of field in stream.
+ */
+size_t BitPatch_GetOffsetBit(const BitPatch_T * p_self, size_t index, void * data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //BIT_PATCH_H
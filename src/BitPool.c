@@ -0,0 +1,334 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "BitPool.h"
+
+#define NO_SLOT  UINT32_MAX
+#define TAG_UNIT ((uint64_t) 1 << 32)
+
+/**
+ * Slot header, followed by message struct and its arena.
+ */
+typedef struct {
+    _Atomic uint32_t next;  /*!< Index + 1 of the next free slot on the freelist, 0 for the last one. */
+} SlotHeader_T;
+
+_Static_assert(sizeof(SlotHeader_T) == sizeof(uint32_t), "Slot header size does not match BIT_POOL_SLOT_SIZE");
+
+/**
+ * Saturating addition.
+ *
+ * @param a     Operand.
+ * @param b     Operand.
+ * @return      Sum, SIZE_MAX on overflow.
+ */
+static size_t AddSize(size_t a, size_t b);
+
+/**
+ * Saturating multiplication.
+ *
+ * @param a     Operand.
+ * @param b     Operand.
+ * @return      Product, SIZE_MAX on overflow.
+ */
+static size_t MulSize(size_t a, size_t b);
+
+/**
+ * Get size of pool slot, see BIT_POOL_SLOT_SIZE.
+ *
+ * @param struct_size   Size of message struct in bytes.
+ * @param data_size     Size of variable length data in bytes.
+ * @return              Slot size, SIZE_MAX on overflow.
+ */
+static size_t GetSlotSize(size_t struct_size, size_t data_size);
+
+/**
+ * Get maximal value of LEN field at given struct offset.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param offset        Offset of LEN field value.
+ * @return              Maximal value, SIZE_MAX if there is no such field.
+ */
+static size_t GetMaxLen(const BitField_T * p_fields, size_t no_fields, size_t offset);
+
+/**
+ * Get slot header.
+ *
+ * @param p_pool    Pool.
+ * @param index     Slot index.
+ * @return          Slot header.
+ */
+static SlotHeader_T * GetSlot(BitPool_T * p_pool, uint32_t index);
+
+/**
+ * Push slot to the global freelist.
+ *
+ * @param p_pool    Pool.
+ * @param index     Slot index.
+ */
+static void Push(BitPool_T * p_pool, uint32_t index);
+
+/**
+ * Pop slot from the global freelist.
+ *
+ * @param p_pool    Pool.
+ * @return          Slot index, NO_SLOT if freelist is empty.
+ */
+static uint32_t Pop(BitPool_T * p_pool);
+
+size_t BitPool_GetDataSize(const BitField_T * p_fields, size_t no_fields) {
+    ASSERT(p_fields != NULL);
+
+    size_t result = 0;
+
+    for(size_t i = 0; i < no_fields; i++) {
+        const BitField_T * p_field = &p_fields[i];
+
+        switch(p_field->field_type) {
+            case ARRAY_VARIABLE:
+            case ARRAY_VARIABLE_WHOLE_MSG:
+                result = AddSize(result, GetMaxLen(p_fields, no_fields, p_field->array_variable_f.len_offset));
+                break;
+
+            case SUBMSG:
+                result = AddSize(result, BitPool_GetDataSize(p_field->submsg_f.p_fields, p_field->submsg_f.no_fields));
+                break;
+
+            case UNION: {
+                size_t max = 0;
+                for(size_t j = 0; j < p_field->union_f.no_cases; j++) {
+                    const BitUnionCase_T * p_case = &p_field->union_f.p_cases[j];
+                    size_t size = BitPool_GetDataSize(p_case->p_fields, p_case->no_fields);
+                    if(size > max)
+                        max = size;
+                }
+
+                result = AddSize(result, max);
+                break;
+            }
+
+            case REPEATED: {
+                size_t count = GetMaxLen(p_fields, no_fields, p_field->repeated_f.count_offset);
+                size_t item  = AddSize(p_field->repeated_f.stride,
+                                       BitPool_GetDataSize(p_field->repeated_f.p_fields, p_field->repeated_f.no_fields));
+
+                result = AddSize(result, AddSize(MulSize(count, item), _Alignof(max_align_t) - 1));
+                break;
+            }
+
+            default:
+                break;
+        }
+    }
+
+    return result;
+}
+
+Status_T BitPool_Init(BitPool_T * p_self, const BitField_T * p_fields, size_t no_fields, size_t struct_size,
+                      size_t data_size, uint8_t * p_memory, size_t len) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_fields != NULL);
+    ASSERT(p_memory != NULL);
+    ASSERT((uintptr_t) p_memory % _Alignof(max_align_t) == 0);
+
+    p_self->p_fields    = p_fields;
+    p_self->no_fields   = no_fields;
+    p_self->p_memory    = p_memory;
+    p_self->slot_size   = GetSlotSize(struct_size, data_size);
+    p_self->struct_size = struct_size;
+    p_self->data_size   = data_size;
+    p_self->no_slots    = p_self->slot_size != SIZE_MAX ? MIN(len / p_self->slot_size, (size_t) NO_SLOT) : 0;
+
+    atomic_init(&p_self->head, 0);
+    if(p_self->no_slots == 0)
+        return ERROR_BUFFER_TOO_SHORT;
+
+    /* Chain all slots in order, the first one on top. */
+    for(size_t i = 0; i < p_self->no_slots; i++)
+        atomic_init(&GetSlot(p_self, (uint32_t) i)->next, i + 1 < p_self->no_slots ? (uint32_t) (i + 2) : 0);
+
+    atomic_store_explicit(&p_self->head, 1, memory_order_release);
+    return STATUS_SUCCESS;
+}
+
+void BitPool_InitCache(BitPoolCache_T * p_self, BitPool_T * p_pool) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_pool != NULL);
+
+    p_self->p_pool   = p_pool;
+    p_self->no_slots = 0;
+}
+
+void * BitPool_Acquire(BitPoolCache_T * p_self) {
+    ASSERT(p_self != NULL);
+
+    BitPool_T * p_pool = p_self->p_pool;
+
+    /* Refill half of the cache at once, so that threads rarely touch the global freelist. */
+    while(p_self->no_slots < BIT_POOL_CACHE_SIZE / 2) {
+        uint32_t index = Pop(p_pool);
+        if(index == NO_SLOT)
+            break;
+
+        p_self->slots[p_self->no_slots++] = index;
+    }
+
+    if(p_self->no_slots == 0)
+        return NULL;
+
+    uint8_t * data = (uint8_t *) GetSlot(p_pool, p_self->slots[--p_self->no_slots]) +
+                     BIT_POOL_ALIGN(sizeof(SlotHeader_T));
+
+    memset(data, 0, p_pool->struct_size);
+    return data;
+}
+
+void BitPool_Release(BitPoolCache_T * p_self, void * data) {
+    ASSERT(p_self != NULL);
+    ASSERT(data != NULL);
+
+    BitPool_T * p_pool = p_self->p_pool;
+    size_t      offset = (size_t) ((uint8_t *) data - p_pool->p_memory) - BIT_POOL_ALIGN(sizeof(SlotHeader_T));
+
+    ASSERT((uint8_t *) data > p_pool->p_memory);
+    ASSERT(offset % p_pool->slot_size == 0 && offset / p_pool->slot_size < p_pool->no_slots);
+
+    if(p_self->no_slots == BIT_POOL_CACHE_SIZE) {
+        while(p_self->no_slots > BIT_POOL_CACHE_SIZE / 2)
+            Push(p_pool, p_self->slots[--p_self->no_slots]);
+    }
+
+    p_self->slots[p_self->no_slots++] = (uint32_t) (offset / p_pool->slot_size);
+}
+
+void BitPool_Flush(BitPoolCache_T * p_self) {
+    ASSERT(p_self != NULL);
+
+    while(p_self->no_slots != 0)
+        Push(p_self->p_pool, p_self->slots[--p_self->no_slots]);
+}
+
+Status_T BitPool_Deserialize(BitPoolCache_T * p_self, Stream_T * p_stream, void ** p_data) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_data != NULL);
+
+    BitPool_T * p_pool = p_self->p_pool;
+    uint8_t *   data   = BitPool_Acquire(p_self);
+    if(data == NULL)
+        return ERROR_BUFFER_TOO_SHORT;
+
+    BitArena_T arena;
+    BitArena_Init(&arena, data + BIT_POOL_ALIGN(p_pool->struct_size), p_pool->data_size);
+
+    Status_T result = BitParser_DeserializeArena(p_pool->p_fields, p_pool->no_fields, data, p_stream, &arena);
+    if(result != STATUS_SUCCESS) {
+        BitPool_Release(p_self, data);
+        return result;
+    }
+
+    (*p_data) = data;
+    return STATUS_SUCCESS;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static size_t AddSize(size_t a, size_t b) {
+    return a > SIZE_MAX - b ? SIZE_MAX : a + b;
+}
+
+static size_t MulSize(size_t a, size_t b) {
+    return b != 0 && a > SIZE_MAX / b ? SIZE_MAX : a * b;
+}
+
+static size_t GetSlotSize(size_t struct_size, size_t data_size) {
+    const size_t align = _Alignof(max_align_t);
+
+    if(struct_size > SIZE_MAX - (align - 1) || data_size > SIZE_MAX - (align - 1))
+        return SIZE_MAX;
+
+    return AddSize(AddSize(BIT_POOL_ALIGN(sizeof(SlotHeader_T)), BIT_POOL_ALIGN(struct_size)),
+                   BIT_POOL_ALIGN(data_size));
+}
+
+static size_t GetMaxLen(const BitField_T * p_fields, size_t no_fields, size_t offset) {
+    ASSERT(p_fields != NULL);
+
+    for(size_t i = 0; i < no_fields; i++) {
+        if(p_fields[i].field_type != LEN || p_fields[i].len_f.offset != offset)
+            continue;
+
+        size_t bit = p_fields[i].len_f.bit;
+        return bit >= sizeof(size_t) * BITS_IN_BYTE ? SIZE_MAX : ((size_t) 1 << bit) - 1;
+    }
+
+    return SIZE_MAX;
+}
+
+static SlotHeader_T * GetSlot(BitPool_T * p_pool, uint32_t index) {
+    ASSERT(p_pool != NULL);
+    ASSERT(index < p_pool->no_slots);
+
+    return (SlotHeader_T *) (p_pool->p_memory + index * p_pool->slot_size);
+}
+
+static void Push(BitPool_T * p_pool, uint32_t index) {
+    ASSERT(p_pool != NULL);
+
+    SlotHeader_T * p_slot = GetSlot(p_pool, index);
+    uint64_t       head   = atomic_load_explicit(&p_pool->head, memory_order_relaxed);
+    uint64_t       next;
+
+    /* Tag is bumped on every change, so a stale head never compares equal (ABA). */
+    do {
+        atomic_store_explicit(&p_slot->next, (uint32_t) head, memory_order_relaxed);
+        next = ((head & ~(TAG_UNIT - 1)) + TAG_UNIT) | (index + 1);
+    } while(!atomic_compare_exchange_weak_explicit(&p_pool->head, &head, next, memory_order_release,
+                                                   memory_order_relaxed));
+}
+
+static uint32_t Pop(BitPool_T * p_pool) {
+    ASSERT(p_pool != NULL);
+
+    uint64_t head = atomic_load_explicit(&p_pool->head, memory_order_acquire);
+    uint64_t next;
+
+    do {
+        uint32_t top = (uint32_t) head;
+        if(top == 0)
+            return NO_SLOT;
+
+        next = ((head & ~(TAG_UNIT - 1)) + TAG_UNIT) |
+               atomic_load_explicit(&GetSlot(p_pool, top - 1)->next, memory_order_relaxed);
+    } while(!atomic_compare_exchange_weak_explicit(&p_pool->head, &head, next, memory_order_acquire,
+                                                   memory_order_acquire));
+
+    return (uint32_t) head - 1;
+}
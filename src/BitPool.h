@@ -0,0 +1,154 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_POOL_H
+#define BIT_POOL_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdatomic.h>
+
+#include "BitParser.h"
+#include "BitArena.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+#define BIT_POOL_CACHE_SIZE 16u  /*!< Number of slots cached per thread. */
+
+#define BIT_POOL_ALIGN(x) (((x) + _Alignof(max_align_t) - 1) / _Alignof(max_align_t) * _Alignof(max_align_t))
+
+/**
+ * Size of pool slot holding message struct of struct_size bytes and data_size bytes of its variable length
+ * data, including slot header. Wraps for sizes close to SIZE_MAX, which BitPool_Init rejects.
+ */
+#define BIT_POOL_SLOT_SIZE(struct_size, data_size) \
+    (BIT_POOL_ALIGN(sizeof(uint32_t)) + BIT_POOL_ALIGN(struct_size) + BIT_POOL_ALIGN(data_size))
+
+/**
+ * Pool of decoded message structs of a single descriptor.
+ *
+ * Pool memory is provided by the caller and split into equal slots, each holding a message struct and an
+ * arena for its variable length data, see BitParser_DeserializeArena. Free slots are kept on a lock-free
+ * global freelist and in per-thread caches, so acquiring and releasing a slot does not allocate and
+ * usually does not touch shared memory. Struct may be released by another thread than the one that
+ * acquired it.
+ */
+typedef struct {
+    const BitField_T * p_fields;    /*!< Bit field message descriptor. */
+    size_t             no_fields;   /*!< Number of fields in descriptor. */
+    uint8_t *          p_memory;    /*!< Pool memory. */
+    size_t             slot_size;   /*!< Size of slot in bytes. */
+    size_t             struct_size; /*!< Size of message struct in bytes. */
+    size_t             data_size;   /*!< Size of arena for variable length data in bytes. */
+    size_t             no_slots;    /*!< Number of slots. */
+    _Atomic uint64_t   head;        /*!< Freelist head, ABA tag in high half, slot index + 1 in low half. */
+} BitPool_T;
+
+/**
+ * Per-thread cache of free slots. Shall be used by a single thread only.
+ */
+typedef struct {
+    BitPool_T * p_pool;                         /*!< Pool. */
+    uint32_t    slots[BIT_POOL_CACHE_SIZE];     /*!< Cached free slot indices. */
+    size_t      no_slots;                       /*!< Number of cached slots. */
+} BitPoolCache_T;
+
+/**
+ * Get upper bound of variable length data of a message, ie. bytes of ARRAY_VARIABLE arrays and REPEATED
+ * items with maximal values of their LEN fields, including worst case alignment of items.
+ *
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @return              Size in bytes, SIZE_MAX if it does not fit size_t.
+ */
+size_t BitPool_GetDataSize(const BitField_T * p_fields, size_t no_fields);
+
+/**
+ * Initialize pool. All slots are free.
+ *
+ * @param p_self        Pointer to allocated pool object.
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param struct_size   Size of message struct in bytes.
+ * @param data_size     Size of variable length data of a message in bytes, eg. BitPool_GetDataSize.
+ * @param p_memory      Pool memory, aligned as max_align_t.
+ * @param len           Size of pool memory, BIT_POOL_SLOT_SIZE(struct_size, data_size) per slot.
+ * @return              Status. ERROR_BUFFER_TOO_SHORT if memory does not hold a single slot, also if slot size
+ *                      does not fit size_t, eg. for data_size of SIZE_MAX.
+ */
+Status_T BitPool_Init(BitPool_T * p_self, const BitField_T * p_fields, size_t no_fields, size_t struct_size,
+                      size_t data_size, uint8_t * p_memory, size_t len);
+
+/**
+ * Initialize per-thread cache of pool. Cache is initially empty.
+ *
+ * @param p_self        Pointer to allocated cache object.
+ * @param p_pool        Pool.
+ */
+void BitPool_InitCache(BitPoolCache_T * p_self, BitPool_T * p_pool);
+
+/**
+ * Acquire zeroed message struct from pool.
+ *
+ * @param p_self        Pointer to cache object.
+ * @return              Message struct or NULL if pool is exhausted.
+ */
+void * BitPool_Acquire(BitPoolCache_T * p_self);
+
+/**
+ * Return message struct, with its variable length data, to pool.
+ *
+ * @param p_self        Pointer to cache object.
+ * @param data          Message struct acquired from the same pool.
+ */
+void BitPool_Release(BitPoolCache_T * p_self, void * data);
+
+/**
+ * Return all cached slots to the global freelist, eg. before thread exits.
+ *
+ * @param p_self        Pointer to cache object.
+ */
+void BitPool_Flush(BitPoolCache_T * p_self);
+
+/**
+ * Deserialize message into struct acquired from pool, variable length data are allocated from the slot
+ * arena. On failure the struct is released.
+ *
+ * @param p_self        Pointer to cache object.
+ * @param p_stream      Stream to read data.
+ * @param p_data        Output message struct, to be given to BitPool_Release.
+ * @return              Status. ERROR_BUFFER_TOO_SHORT if pool is exhausted or message data does not fit slot.
+ */
+Status_T BitPool_Deserialize(BitPoolCache_T * p_self, Stream_T * p_stream, void ** p_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //BIT_POOL_H
@@ -0,0 +1,689 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "BitSchema.h"
+
+#define ALIGN_UP(x, align) (((x) + (align) - 1) / (align) * (align))
+#define MAX_TOKENS         5u
+
+/**
+ * Schema text token, not null terminated.
+ */
+typedef struct {
+    const char * p_text;    /*!< First character. */
+    size_t       len;       /*!< Number of characters. */
+} Token_T;
+
+/**
+ * Struct being parsed.
+ */
+typedef struct {
+    size_t first;       /*!< Index of the first field of struct. */
+    size_t offset;      /*!< Offset of the next member relative to struct start. */
+    size_t align;       /*!< Alignment of struct. */
+    size_t no_names;    /*!< Number of names visible before struct was opened. */
+} Scope_T;
+
+/**
+ * Named LEN field.
+ */
+typedef struct {
+    Token_T name;       /*!< Field name. */
+    size_t  offset;     /*!< Offset of field value relative to its struct start. */
+} Name_T;
+
+/**
+ * Schema parser state.
+ */
+typedef struct {
+    BitField_T * p_fields;                          /*!< Storage for descriptor. */
+    size_t       max_fields;                        /*!< Number of fields storage can hold. */
+    size_t       no_fields;                         /*!< Number of parsed fields. */
+    Scope_T      scopes[BIT_SCHEMA_MAX_DEPTH];      /*!< Open structs, outermost first. */
+    size_t       depth;                             /*!< Number of open structs. */
+    Name_T       names[BIT_SCHEMA_MAX_NAMES];       /*!< Visible LEN fields. */
+    size_t       no_names;                          /*!< Number of visible LEN fields. */
+} Parser_T;
+
+/**
+ * Value field type keyword.
+ */
+typedef struct {
+    const char *   p_keyword;   /*!< Keyword. */
+    BitFieldType_T type;        /*!< Field type. */
+    size_t         size;        /*!< Size of value in bytes. */
+    size_t         align;       /*!< Alignment of value in bytes. */
+    bool           has_width;   /*!< True if keyword is followed by width in bits. */
+} Keyword_T;
+
+static const Keyword_T keywords[] = {
+    {"u8",     U8,     sizeof(uint8_t),  _Alignof(uint8_t),  true},
+    {"i8",     I8,     sizeof(int8_t),   _Alignof(int8_t),   true},
+    {"s8",     S8,     sizeof(int8_t),   _Alignof(int8_t),   true},
+    {"u16",    U16,    sizeof(uint16_t), _Alignof(uint16_t), true},
+    {"i16",    I16,    sizeof(int16_t),  _Alignof(int16_t),  true},
+    {"s16",    S16,    sizeof(int16_t),  _Alignof(int16_t),  true},
+    {"u32",    U32,    sizeof(uint32_t), _Alignof(uint32_t), true},
+    {"i32",    I32,    sizeof(int32_t),  _Alignof(int32_t),  true},
+    {"s32",    S32,    sizeof(int32_t),  _Alignof(int32_t),  true},
+    {"u64",    U64,    sizeof(uint64_t), _Alignof(uint64_t), true},
+    {"i64",    I64,    sizeof(int64_t),  _Alignof(int64_t),  true},
+    {"s64",    S64,    sizeof(int64_t),  _Alignof(int64_t),  true},
+    {"float",  FLOAT,  sizeof(float),    _Alignof(float),    false},
+    {"double", DOUBLE, sizeof(double),   _Alignof(double),   false},
+    {"len",    LEN,    sizeof(size_t),   _Alignof(size_t),   true},
+};
+
+/**
+ * Split line into tokens, up to comment.
+ *
+ * @param p_line        First character of line.
+ * @param len           Length of line without new line character.
+ * @param p_tokens      Output tokens, MAX_TOKENS.
+ * @return              Number of tokens, MAX_TOKENS + 1 if line has more tokens.
+ */
+static size_t SplitLine(const char * p_line, size_t len, Token_T * p_tokens);
+
+/**
+ * Compare token with null terminated string.
+ *
+ * @param p_token   Token.
+ * @param p_string  String.
+ * @return          True if equal.
+ */
+static bool IsToken(const Token_T * p_token, const char * p_string);
+
+/**
+ * Parse decimal number token.
+ *
+ * @param p_token   Token.
+ * @param p_value   Output value.
+ * @return          True if token is a decimal number.
+ */
+static bool ParseNumber(const Token_T * p_token, size_t * p_value);
+
+/**
+ * Parse single non empty line of schema.
+ *
+ * @param p_parser      Parser state.
+ * @param p_tokens      Tokens of line.
+ * @param no_tokens     Number of tokens.
+ * @return              Status.
+ */
+static Status_T ParseLine(Parser_T * p_parser, const Token_T * p_tokens, size_t no_tokens);
+
+/**
+ * Parse array field line.
+ *
+ * @param p_parser      Parser state.
+ * @param p_tokens      Tokens of line.
+ * @param no_tokens     Number of tokens.
+ * @param p_field       Output field description.
+ * @return              Status.
+ */
+static Status_T ParseArray(Parser_T * p_parser, const Token_T * p_tokens, size_t no_tokens, BitField_T * p_field);
+
+/**
+ * Parse value field line.
+ *
+ * @param p_parser      Parser state.
+ * @param p_tokens      Tokens of line.
+ * @param no_tokens     Number of tokens.
+ * @param p_field       Output field description.
+ * @return              Status.
+ */
+static Status_T ParseValue(Parser_T * p_parser, const Token_T * p_tokens, size_t no_tokens, BitField_T * p_field);
+
+/**
+ * Reserve space for a member of the innermost open struct.
+ *
+ * @param p_scope   Struct.
+ * @param size      Size of member.
+ * @param align     Alignment of member.
+ * @return          Offset of member relative to struct start.
+ */
+static size_t AddMember(Scope_T * p_scope, size_t size, size_t align);
+
+/**
+ * Fill value field description.
+ *
+ * @param p_field   Field description.
+ * @param type      Integer, FLOAT, DOUBLE or LEN field type.
+ * @param offset    Offset of value.
+ * @param bit       Width of field in bits, ignored for FLOAT and DOUBLE fields.
+ */
+static void SetValueField(BitField_T * p_field, BitFieldType_T type, size_t offset, size_t bit);
+
+/**
+ * Move field value, and length of variable arrays, by given offset.
+ *
+ * @param p_field   Field description.
+ * @param offset    Offset in bytes.
+ */
+static void Relocate(BitField_T * p_field, size_t offset);
+
+/**
+ * Check if field of binary image is a valid field of a flat descriptor of message struct of given size.
+ *
+ * @param p_field   Field description.
+ * @param size      Size of message struct.
+ * @return          True if valid.
+ */
+static bool IsValidField(const BitField_T * p_field, size_t size);
+
+Status_T BitSchema_Parse(BitSchema_T * p_self, const char * p_text, size_t len, BitField_T * p_fields,
+                         size_t max_fields, size_t * p_line) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_text != NULL);
+    ASSERT(p_fields != NULL);
+
+    Parser_T parser = {
+        .p_fields   = p_fields,
+        .max_fields = max_fields,
+        .scopes     = {{.align = 1}},
+        .depth      = 1,
+    };
+
+    size_t line = 0;
+    for(size_t start = 0; start < len;) {
+        size_t end = start;
+        while(end < len && p_text[end] != '\n')
+            end++;
+
+        line++;
+        if(p_line != NULL)
+            (*p_line) = line;
+
+        Token_T tokens[MAX_TOKENS];
+        size_t  no_tokens = SplitLine(p_text + start, end - start, tokens);
+        if(no_tokens > MAX_TOKENS)
+            return ERROR_DESCRIPTOR_INVALID;
+
+        if(no_tokens != 0) {
+            Status_T result = ParseLine(&parser, tokens, no_tokens);
+            if(result != STATUS_SUCCESS)
+                return result;
+        }
+
+        start = end + 1;
+    }
+
+    if(parser.depth != 1)
+        return ERROR_DESCRIPTOR_INVALID;
+
+    p_self->p_fields  = p_fields;
+    p_self->no_fields = parser.no_fields;
+    p_self->size      = ALIGN_UP(parser.scopes[0].offset, parser.scopes[0].align);
+
+    return STATUS_SUCCESS;
+}
+
+Status_T BitSchema_Save(const BitSchema_T * p_self, uint8_t * p_buffer, size_t len) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_buffer != NULL);
+
+    if(len < BIT_SCHEMA_IMAGE_SIZE(p_self->no_fields))
+        return ERROR_BUFFER_TOO_SHORT;
+
+    BitSchemaHeader_T header = {
+        .magic      = BIT_SCHEMA_MAGIC,
+        .version    = BIT_SCHEMA_VERSION,
+        .field_size = sizeof(BitField_T),
+        .no_fields  = (uint32_t) p_self->no_fields,
+        .size       = (uint32_t) p_self->size,
+    };
+
+    memcpy(p_buffer, &header, sizeof(header));
+    memcpy(p_buffer + sizeof(header), p_self->p_fields, p_self->no_fields * sizeof(BitField_T));
+
+    return STATUS_SUCCESS;
+}
+
+Status_T BitSchema_Map(BitSchema_T * p_self, const void * p_image, size_t len) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_image != NULL);
+    ASSERT((uintptr_t) p_image % _Alignof(BitField_T) == 0);
+
+    if(len < sizeof(BitSchemaHeader_T))
+        return ERROR_STREAM_TOO_SHORT;
+
+    const BitSchemaHeader_T * p_header = p_image;
+    if(p_header->magic != BIT_SCHEMA_MAGIC || p_header->version != BIT_SCHEMA_VERSION ||
+       p_header->field_size != sizeof(BitField_T))
+        return ERROR_DESCRIPTOR_INVALID;
+
+    if(len < BIT_SCHEMA_IMAGE_SIZE(p_header->no_fields))
+        return ERROR_STREAM_TOO_SHORT;
+
+    const BitField_T * p_fields = (const BitField_T *) (p_header + 1);
+    for(size_t i = 0; i < p_header->no_fields; i++) {
+        if(!IsValidField(&p_fields[i], p_header->size))
+            return ERROR_DESCRIPTOR_INVALID;
+    }
+
+    Status_T result = BitParser_Validate(p_fields, p_header->no_fields);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    p_self->p_fields  = p_fields;
+    p_self->no_fields = p_header->no_fields;
+    p_self->size      = p_header->size;
+
+    return STATUS_SUCCESS;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static size_t SplitLine(const char * p_line, size_t len, Token_T * p_tokens) {
+    ASSERT(p_line != NULL);
+    ASSERT(p_tokens != NULL);
+
+    size_t no_tokens = 0;
+    size_t i         = 0;
+
+    while(i < len && p_line[i] != '#') {
+        if(p_line[i] == ' ' || p_line[i] == '\t' || p_line[i] == '\r') {
+            i++;
+            continue;
+        }
+
+        if(no_tokens == MAX_TOKENS)
+            return MAX_TOKENS + 1;
+
+        size_t start = i;
+        while(i < len && p_line[i] != ' ' && p_line[i] != '\t' && p_line[i] != '\r' && p_line[i] != '#')
+            i++;
+
+        p_tokens[no_tokens].p_text = p_line + start;
+        p_tokens[no_tokens].len    = i - start;
+        no_tokens++;
+    }
+
+    return no_tokens;
+}
+
+static bool IsToken(const Token_T * p_token, const char * p_string) {
+    ASSERT(p_token != NULL);
+    ASSERT(p_string != NULL);
+
+    return strlen(p_string) == p_token->len && memcmp(p_token->p_text, p_string, p_token->len) == 0;
+}
+
+static bool ParseNumber(const Token_T * p_token, size_t * p_value) {
+    ASSERT(p_token != NULL);
+    ASSERT(p_value != NULL);
+
+    size_t value = 0;
+    for(size_t i = 0; i < p_token->len; i++) {
+        char c = p_token->p_text[i];
+        if(c < '0' || c > '9' || value > (SIZE_MAX - 9) / 10)
+            return false;
+
+        value = value * 10 + (size_t) (c - '0');
+    }
+
+    (*p_value) = value;
+    return p_token->len != 0;
+}
+
+static Status_T ParseLine(Parser_T * p_parser, const Token_T * p_tokens, size_t no_tokens) {
+    ASSERT(p_parser != NULL);
+    ASSERT(p_tokens != NULL);
+    ASSERT(no_tokens != 0);
+
+    Scope_T * p_scope = &p_parser->scopes[p_parser->depth - 1];
+
+    if(IsToken(&p_tokens[0], "struct")) {
+        if(no_tokens != 3 || !IsToken(&p_tokens[2], "{") || p_parser->depth == BIT_SCHEMA_MAX_DEPTH)
+            return ERROR_DESCRIPTOR_INVALID;
+
+        Scope_T * p_nested = &p_parser->scopes[p_parser->depth++];
+        p_nested->first    = p_parser->no_fields;
+        p_nested->offset   = 0;
+        p_nested->align    = 1;
+        p_nested->no_names = p_parser->no_names;
+
+        return STATUS_SUCCESS;
+    }
+
+    if(IsToken(&p_tokens[0], "}")) {
+        if(no_tokens != 1 || p_parser->depth == 1)
+            return ERROR_DESCRIPTOR_INVALID;
+
+        /* Struct is complete, place it in its parent as a member of its size and alignment. */
+        size_t offset = AddMember(p_scope - 1, ALIGN_UP(p_scope->offset, p_scope->align), p_scope->align);
+        for(size_t i = p_scope->first; i < p_parser->no_fields; i++)
+            Relocate(&p_parser->p_fields[i], offset);
+
+        p_parser->no_names = p_scope->no_names;
+        p_parser->depth--;
+
+        return STATUS_SUCCESS;
+    }
+
+    if(p_parser->no_fields == p_parser->max_fields)
+        return ERROR_BUFFER_TOO_SHORT;
+
+    BitField_T field = {.order = BIT_ORDER_STREAM};
+    Status_T   result = STATUS_SUCCESS;
+
+    if(IsToken(&p_tokens[0], "align")) {
+        field.field_type = ALIGN;
+        if(no_tokens != 1)
+            result = ERROR_DESCRIPTOR_INVALID;
+    }
+    else if(IsToken(&p_tokens[0], "pad")) {
+        field.field_type = PAD;
+        if(no_tokens != 2 || !ParseNumber(&p_tokens[1], &field.pad_f.bit))
+            result = ERROR_DESCRIPTOR_INVALID;
+    }
+    else if(IsToken(&p_tokens[0], "bytes") || IsToken(&p_tokens[0], "rest")) {
+        result = ParseArray(p_parser, p_tokens, no_tokens, &field);
+    }
+    else {
+        result = ParseValue(p_parser, p_tokens, no_tokens, &field);
+    }
+
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    p_parser->p_fields[p_parser->no_fields++] = field;
+    return STATUS_SUCCESS;
+}
+
+static Status_T ParseArray(Parser_T * p_parser, const Token_T * p_tokens, size_t no_tokens, BitField_T * p_field) {
+    ASSERT(p_parser != NULL);
+    ASSERT(p_tokens != NULL);
+    ASSERT(p_field != NULL);
+
+    if(no_tokens != 3)
+        return ERROR_DESCRIPTOR_INVALID;
+
+    Scope_T * p_scope = &p_parser->scopes[p_parser->depth - 1];
+    size_t    len;
+
+    if(IsToken(&p_tokens[0], "bytes") && ParseNumber(&p_tokens[1], &len)) {
+        p_field->field_type           = ARRAY_FIXED;
+        p_field->array_fixed_f.offset = AddMember(p_scope, sizeof(uint8_t *), _Alignof(uint8_t *));
+        p_field->array_fixed_f.len    = len;
+        return STATUS_SUCCESS;
+    }
+
+    /* Length shall be a LEN field of the same struct, latest one wins. */
+    for(size_t i = p_parser->no_names; i > p_scope->no_names; i--) {
+        const Name_T * p_name = &p_parser->names[i - 1];
+        if(p_name->name.len != p_tokens[1].len ||
+           memcmp(p_name->name.p_text, p_tokens[1].p_text, p_name->name.len) != 0)
+            continue;
+
+        p_field->field_type = IsToken(&p_tokens[0], "bytes") ? ARRAY_VARIABLE : ARRAY_VARIABLE_WHOLE_MSG;
+        p_field->array_variable_f.offset     = AddMember(p_scope, sizeof(uint8_t *), _Alignof(uint8_t *));
+        p_field->array_variable_f.len_offset = p_name->offset;
+        return STATUS_SUCCESS;
+    }
+
+    return ERROR_DESCRIPTOR_INVALID;
+}
+
+static Status_T ParseValue(Parser_T * p_parser, const Token_T * p_tokens, size_t no_tokens, BitField_T * p_field) {
+    ASSERT(p_parser != NULL);
+    ASSERT(p_tokens != NULL);
+    ASSERT(p_field != NULL);
+
+    const Keyword_T * p_keyword = NULL;
+    for(size_t i = 0; i < ARRAY_LEN(keywords) && p_keyword == NULL; i++) {
+        if(IsToken(&p_tokens[0], keywords[i].p_keyword))
+            p_keyword = &keywords[i];
+    }
+
+    if(p_keyword == NULL)
+        return ERROR_DESCRIPTOR_INVALID;
+
+    size_t bit  = p_keyword->size * BITS_IN_BYTE;
+    size_t next = 1;
+    if(p_keyword->has_width) {
+        if(no_tokens < 2 || !ParseNumber(&p_tokens[1], &bit) || bit == 0 || bit > p_keyword->size * BITS_IN_BYTE)
+            return ERROR_DESCRIPTOR_INVALID;
+
+        next++;
+    }
+
+    /* Name is required, byte order is optional except for LEN fields. */
+    if(no_tokens != next + 1 && (no_tokens != next + 2 || p_keyword->type == LEN))
+        return ERROR_DESCRIPTOR_INVALID;
+
+    if(no_tokens == next + 2) {
+        const Token_T * p_order = &p_tokens[next + 1];
+
+        if(IsToken(p_order, "be"))
+            p_field->order = BIT_ORDER_BIG;
+        else if(IsToken(p_order, "le"))
+            p_field->order = BIT_ORDER_LITTLE;
+        else if(IsToken(p_order, "ws") && bit % (2 * BITS_IN_BYTE) == 0)
+            p_field->order = BIT_ORDER_WORD_SWAPPED;
+        else
+            return ERROR_DESCRIPTOR_INVALID;
+
+        if(bit % BITS_IN_BYTE != 0)
+            return ERROR_DESCRIPTOR_INVALID;
+    }
+
+    Scope_T * p_scope = &p_parser->scopes[p_parser->depth - 1];
+    size_t    offset  = AddMember(p_scope, p_keyword->size, p_keyword->align);
+    SetValueField(p_field, p_keyword->type, offset, bit);
+
+    if(p_keyword->type == LEN) {
+        if(p_parser->no_names == BIT_SCHEMA_MAX_NAMES)
+            return ERROR_BUFFER_TOO_SHORT;
+
+        p_parser->names[p_parser->no_names].name   = p_tokens[next];
+        p_parser->names[p_parser->no_names].offset = offset;
+        p_parser->no_names++;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static size_t AddMember(Scope_T * p_scope, size_t size, size_t align) {
+    ASSERT(p_scope != NULL);
+    ASSERT(align != 0);
+
+    size_t offset = ALIGN_UP(p_scope->offset, align);
+
+    p_scope->offset = offset + size;
+    if(align > p_scope->align)
+        p_scope->align = align;
+
+    return offset;
+}
+
+static void SetValueField(BitField_T * p_field, BitFieldType_T type, size_t offset, size_t bit) {
+    ASSERT(p_field != NULL);
+
+    p_field->field_type = type;
+
+    switch(type) {
+        case U8:
+            p_field->u8_f.offset = offset;
+            p_field->u8_f.bit    = bit;
+            break;
+
+        case I8:
+            p_field->i8_f.offset = offset;
+            p_field->i8_f.bit    = bit;
+            break;
+
+        case S8:
+            p_field->s8_f.offset = offset;
+            p_field->s8_f.bit    = bit;
+            break;
+
+        case U16:
+            p_field->u16_f.offset = offset;
+            p_field->u16_f.bit    = bit;
+            break;
+
+        case I16:
+            p_field->i16_f.offset = offset;
+            p_field->i16_f.bit    = bit;
+            break;
+
+        case S16:
+            p_field->s16_f.offset = offset;
+            p_field->s16_f.bit    = bit;
+            break;
+
+        case U32:
+            p_field->u32_f.offset = offset;
+            p_field->u32_f.bit    = bit;
+            break;
+
+        case I32:
+            p_field->i32_f.offset = offset;
+            p_field->i32_f.bit    = bit;
+            break;
+
+        case S32:
+            p_field->s32_f.offset = offset;
+            p_field->s32_f.bit    = bit;
+            break;
+
+        case U64:
+            p_field->u64_f.offset = offset;
+            p_field->u64_f.bit    = bit;
+            break;
+
+        case I64:
+            p_field->i64_f.offset = offset;
+            p_field->i64_f.bit    = bit;
+            break;
+
+        case S64:
+            p_field->s64_f.offset = offset;
+            p_field->s64_f.bit    = bit;
+            break;
+
+        case FLOAT:
+            p_field->float_f.offset = offset;
+            break;
+
+        case DOUBLE:
+            p_field->double_f.offset = offset;
+            break;
+
+        case LEN:
+            p_field->len_f.offset  = offset;
+            p_field->len_f.bit     = bit;
+            p_field->len_f.is_auto = false;
+            break;
+
+        default:
+            ASSERT(false);
+            break;
+    }
+}
+
+static void Relocate(BitField_T * p_field, size_t offset) {
+    ASSERT(p_field != NULL);
+
+    switch(p_field->field_type) {
+        case ARRAY_FIXED:
+            p_field->array_fixed_f.offset += offset;
+            break;
+
+        case ARRAY_VARIABLE:
+        case ARRAY_VARIABLE_WHOLE_MSG:
+            p_field->array_variable_f.offset     += offset;
+            p_field->array_variable_f.len_offset += offset;
+            break;
+
+        case ALIGN:
+        case PAD:
+            break;
+
+        default:
+            SetValueField(p_field, p_field->field_type, BitParser_GetFieldOffset(p_field) + offset,
+                          BitParser_GetFieldLengthBit(p_field, NULL, 0));
+            break;
+    }
+}
+
+static bool IsValidField(const BitField_T * p_field, size_t size) {
+    ASSERT(p_field != NULL);
+
+    if(p_field->order > BIT_ORDER_WORD_SWAPPED)
+        return false;
+
+    switch(p_field->field_type) {
+        case ARRAY_FIXED:
+            return p_field->array_fixed_f.offset <= size - sizeof(uint8_t *) && size >= sizeof(uint8_t *);
+
+        case ARRAY_VARIABLE:
+        case ARRAY_VARIABLE_WHOLE_MSG:
+            return size >= sizeof(uint8_t *) && size >= sizeof(size_t) &&
+                   p_field->array_variable_f.offset <= size - sizeof(uint8_t *) &&
+                   p_field->array_variable_f.len_offset <= size - sizeof(size_t);
+
+        case ALIGN:
+        case PAD:
+            return true;
+
+        case U8:
+        case I8:
+        case S8:
+        case U16:
+        case I16:
+        case S16:
+        case U32:
+        case I32:
+        case S32:
+        case U64:
+        case I64:
+        case S64:
+        case FLOAT:
+        case DOUBLE:
+        case LEN: {
+            size_t value_size = BitParser_GetValueSize(p_field);
+            size_t bit        = BitParser_GetFieldLengthBit(p_field, NULL, 0);
+
+            size_t offset     = BitParser_GetFieldOffset(p_field);
+
+            if(size < value_size || offset > size - value_size || offset % value_size != 0)
+                return false;
+
+            if(p_field->order != BIT_ORDER_STREAM && bit % BITS_IN_BYTE != 0)
+                return false;
+
+            return bit != 0 && bit <= value_size * BITS_IN_BYTE;
+        }
+
+        default:
+            return false;
+    }
+}
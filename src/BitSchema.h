@@ -0,0 +1,129 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_SCHEMA_H
+#define BIT_SCHEMA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "BitParser.h"
+#include "BitParserError.h"
+
+#define BIT_SCHEMA_MAGIC     0x48435342u  /*!< "BSCH" in little endian. */
+#define BIT_SCHEMA_VERSION   1u
+#define BIT_SCHEMA_MAX_DEPTH 8u           /*!< Maximal nesting of structs in text schema. */
+#define BIT_SCHEMA_MAX_NAMES 16u          /*!< Maximal number of LEN fields in text schema. */
+
+#define BIT_SCHEMA_IMAGE_SIZE(no_fields) (sizeof(BitSchemaHeader_T) + (no_fields) * sizeof(BitField_T))
+
+/**
+ * Message schema loaded at runtime.
+ *
+ * Schema is a flat bit field message descriptor, the same BitParser functions use for static descriptors,
+ * together with the layout of a message struct it describes. Fields are laid out as C compiler would lay
+ * out a struct with the same members, value of a field is at BitParser_GetFieldOffset of it.
+ */
+typedef struct {
+    const BitField_T * p_fields;    /*!< Bit field message descriptor. */
+    size_t             no_fields;   /*!< Number of fields in descriptor. */
+    size_t             size;        /*!< Size of message struct in bytes. */
+} BitSchema_T;
+
+/**
+ * Header of binary schema image. Followed by no_fields bit field descriptions in native representation.
+ */
+typedef struct {
+    uint32_t magic;         /*!< BIT_SCHEMA_MAGIC. */
+    uint16_t version;       /*!< BIT_SCHEMA_VERSION. */
+    uint16_t field_size;    /*!< sizeof(BitField_T) of the writer. */
+    uint32_t no_fields;     /*!< Number of fields. */
+    uint32_t size;          /*!< Size of message struct in bytes. */
+} BitSchemaHeader_T;
+
+/**
+ * Parse text schema into a flat descriptor.
+ *
+ * Schema has one field per line, tokens separated by spaces or tabs, '#' starts a comment:
+ *
+ *     u8|i8|s8|u16|i16|s16|u32|i32|s32|u64|i64|s64 <width> <name> [be|le|ws]
+ *     float|double <name> [be|le|ws]
+ *     len <width> <name>
+ *     bytes <count> <name>         fixed length array
+ *     bytes <len name> <name>      variable length array
+ *     rest <len name> <name>       ARRAY_VARIABLE_WHOLE_MSG array
+ *     align
+ *     pad <width>
+ *     struct <name> {              nested struct, flattened into the descriptor
+ *     }
+ *
+ * Optional byte order overrides stream byte order, see BitOrder_T. LEN fields referred by arrays shall
+ * precede them in the same struct. Array fields are uint8_t pointers in message struct.
+ *
+ * @param p_self        Pointer to schema object.
+ * @param p_text        Schema text, does not need to be null terminated.
+ * @param len           Length of text.
+ * @param p_fields      Storage for descriptor.
+ * @param max_fields    Number of fields storage can hold.
+ * @param p_line        Output line number of the error, first line is 1. May be NULL.
+ * @return              Status. ERROR_DESCRIPTOR_INVALID on syntax error, ERROR_BUFFER_TOO_SHORT if storage
+ *                      is too short.
+ */
+Status_T BitSchema_Parse(BitSchema_T * p_self, const char * p_text, size_t len, BitField_T * p_fields,
+                         size_t max_fields, size_t * p_line);
+
+/**
+ * Save schema as binary image of BIT_SCHEMA_IMAGE_SIZE(no_fields) bytes. Image is meant to be cached and
+ * loaded with BitSchema_Map by the same build of the library.
+ *
+ * @param p_self        Pointer to schema object.
+ * @param p_buffer      Output buffer, aligned as BitField_T.
+ * @param len           Length of buffer.
+ * @return              Status. ERROR_BUFFER_TOO_SHORT if buffer is too short.
+ */
+Status_T BitSchema_Save(const BitSchema_T * p_self, uint8_t * p_buffer, size_t len);
+
+/**
+ * Load schema from binary image without copying it, eg. from memory mapped file. Image is validated, so
+ * it is safe to use it with message structs of p_self->size bytes. Image shall outlive the schema.
+ *
+ * @param p_self        Pointer to schema object.
+ * @param p_image       Binary image, aligned as BitField_T.
+ * @param len           Length of image.
+ * @return              Status. ERROR_DESCRIPTOR_INVALID if image is invalid or was saved by a different
+ *                      build, ERROR_STREAM_TOO_SHORT if image is truncated, errors of BitParser_Validate
+ *                      if mapped descriptor is invalid.
+ */
+Status_T BitSchema_Map(BitSchema_T * p_self, const void * p_image, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //BIT_SCHEMA_H
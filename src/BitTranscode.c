@@ -0,0 +1,476 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+#include <math.h>
+
+#include "BitTranscode.h"
+#include "UParser.h"
+#include "BitParserError.h"
+
+/**
+ * Size of buffer used to copy arrays between streams.
+ */
+#define CHUNK_LEN 32u
+
+/**
+ * Value of any value field type.
+ */
+typedef union {
+    uint8_t  u8;
+    int8_t   i8;
+    uint16_t u16;
+    int16_t  i16;
+    uint32_t u32;
+    int32_t  i32;
+    uint64_t u64;
+    int64_t  i64;
+    float    f;
+    double   d;
+    size_t   len;
+} Value_T;
+
+/**
+ * Value in a type independent form.
+ */
+typedef struct {
+    uint64_t bits;       /*!< Integer value, two's complement if signed. */
+    double   real;       /*!< Floating point value. */
+    bool     is_real;    /*!< True if value is floating point. */
+    bool     is_signed;  /*!< True if integer value is signed. */
+} Register_T;
+
+/**
+ * Resolve bit offsets of all source fields and move source stream past the message.
+ *
+ * @param p_fields      Source message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param p_stream      Source stream.
+ * @param p_offsets     Output no_fields + 1 field bit offsets.
+ * @return              Status.
+ */
+static Status_T Resolve(const BitField_T * p_fields, size_t no_fields, Stream_T * p_stream, size_t * p_offsets);
+
+/**
+ * Get number of bytes of a source array field.
+ *
+ * @param p_fields      Source message descriptor.
+ * @param index         Index of array field.
+ * @param p_stream      Source stream.
+ * @param p_offsets     Resolved bit offsets of fields preceding the array.
+ * @param p_len         Output array length in bytes.
+ * @return              Status.
+ */
+static Status_T GetArrayLen(const BitField_T * p_fields, size_t index, Stream_T * p_stream, const size_t * p_offsets,
+                            size_t * p_len);
+
+/**
+ * Read value of a source field into register.
+ *
+ * @param p_field       Source field description.
+ * @param p_stream      Source stream.
+ * @param bit_index     Bit offset of field.
+ * @param p_register    Output register.
+ * @return              Status.
+ */
+static Status_T Load(const BitField_T * p_field, Stream_T * p_stream, size_t bit_index, Register_T * p_register);
+
+/**
+ * Write value of register into target field.
+ *
+ * @param p_field       Target field description.
+ * @param p_register    Register.
+ * @param p_stream      Target stream.
+ * @return              Status.
+ */
+static Status_T Store(const BitField_T * p_field, const Register_T * p_register, Stream_T * p_stream);
+
+/**
+ * Copy array between streams, truncating or zero padding it to the target length.
+ *
+ * @param p_source      Source stream at the first byte of array.
+ * @param source_len    Source array length in bytes.
+ * @param p_target      Target stream.
+ * @param target_len    Target array length in bytes.
+ * @return              Status.
+ */
+static Status_T Blit(Stream_T * p_source, size_t source_len, Stream_T * p_target, size_t target_len);
+
+/**
+ * Check if field is a single value which can be moved through a register.
+ *
+ * @param p_field       Bit field description.
+ * @return              True for integer, FLOAT, DOUBLE and LEN fields.
+ */
+static bool IsScalar(const BitField_T * p_field);
+
+/**
+ * Check if field is a byte array.
+ *
+ * @param p_field       Bit field description.
+ * @return              True for ARRAY_FIXED and ARRAY_VARIABLE fields.
+ */
+static bool IsArray(const BitField_T * p_field);
+
+/**
+ * Check if field holds a signed integer.
+ *
+ * @param p_field       Bit field description.
+ * @return              True for I and S integer fields.
+ */
+static bool IsSigned(const BitField_T * p_field);
+
+/**
+ * Convert floating point value to integer saturated to the range of target type. NaN converts to zero.
+ *
+ * @param real          Floating point value.
+ * @param is_signed     True if target type is signed.
+ * @param size          Size of target type in bytes.
+ * @return              Integer value, two's complement if signed.
+ */
+static uint64_t Saturate(double real, bool is_signed, size_t size);
+
+Status_T BitTranscode_Message(const BitField_T * p_source_fields, size_t no_source_fields, Stream_T * p_source,
+                              const BitField_T * p_target_fields, size_t no_target_fields, Stream_T * p_target,
+                              const size_t * p_map, size_t * p_offsets) {
+    ASSERT(p_source_fields != NULL);
+    ASSERT(p_source != NULL);
+    ASSERT(p_target_fields != NULL);
+    ASSERT(p_target != NULL);
+    ASSERT(p_map != NULL);
+    ASSERT(p_offsets != NULL);
+
+    Stream_T source = *p_source;
+    Status_T result = Resolve(p_source_fields, no_source_fields, &source, p_offsets);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    for(size_t i = 0; i < no_target_fields; i++) {
+        const BitField_T * p_field = &p_target_fields[i];
+        size_t             index   = p_map[i];
+
+        if(p_field->field_type == ALIGN || p_field->field_type == PAD) {
+            result = BitParser_SerializeField(p_field, NULL, p_target);
+        }
+        else if(IsScalar(p_field)) {
+            Register_T reg = {0};
+
+            if(index != BIT_TRANSCODE_NONE) {
+                if(index >= no_source_fields || !IsScalar(&p_source_fields[index]))
+                    return ERROR_DESCRIPTOR_INVALID;
+
+                result = Load(&p_source_fields[index], p_source, p_offsets[index], &reg);
+                if(result != STATUS_SUCCESS)
+                    return result;
+            }
+
+            result = Store(p_field, &reg, p_target);
+        }
+        else if(IsArray(p_field)) {
+            Stream_T array      = *p_source;
+            size_t   source_len = 0;
+
+            if(index != BIT_TRANSCODE_NONE) {
+                if(index >= no_source_fields || !IsArray(&p_source_fields[index]))
+                    return ERROR_DESCRIPTOR_INVALID;
+
+                result = GetArrayLen(p_source_fields, index, p_source, p_offsets, &source_len);
+                if(result != STATUS_SUCCESS)
+                    return result;
+
+                result = Stream_SeekBit(&array, p_offsets[index]);
+                if(result != STATUS_SUCCESS)
+                    return result;
+            }
+            else if(p_field->field_type == ARRAY_VARIABLE) {
+                return ERROR_DESCRIPTOR_INVALID;
+            }
+
+            size_t target_len = p_field->field_type == ARRAY_FIXED ? p_field->array_fixed_f.len : source_len;
+            result = Blit(&array, source_len, p_target, target_len);
+        }
+        else {
+            return ERROR_DESCRIPTOR_INVALID;
+        }
+
+        if(result != STATUS_SUCCESS)
+            return result;
+    }
+
+    (*p_source) = source;
+    return STATUS_SUCCESS;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static Status_T Resolve(const BitField_T * p_fields, size_t no_fields, Stream_T * p_stream, size_t * p_offsets) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_offsets != NULL);
+
+    size_t bit = Stream_TellBit(p_stream);
+
+    for(size_t i = 0; i < no_fields; i++) {
+        const BitField_T * p_field = &p_fields[i];
+        p_offsets[i] = bit;
+
+        if(p_field->field_type == ARRAY_VARIABLE) {
+            size_t len;
+            Status_T result = GetArrayLen(p_fields, i, p_stream, p_offsets, &len);
+            if(result != STATUS_SUCCESS)
+                return result;
+
+            bit += len * BITS_IN_BYTE;
+        }
+        else if(IsScalar(p_field) || IsArray(p_field) || p_field->field_type == ALIGN || p_field->field_type == PAD) {
+            bit += BitParser_GetFieldLengthBit(p_field, NULL, bit);
+        }
+        else {
+            return ERROR_DESCRIPTOR_INVALID;
+        }
+    }
+
+    p_offsets[no_fields] = bit;
+    return Stream_SeekBit(p_stream, bit);
+}
+
+static Status_T GetArrayLen(const BitField_T * p_fields, size_t index, Stream_T * p_stream, const size_t * p_offsets,
+                            size_t * p_len) {
+    ASSERT(p_fields != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_offsets != NULL);
+    ASSERT(p_len != NULL);
+
+    const BitField_T * p_field = &p_fields[index];
+
+    if(p_field->field_type == ARRAY_FIXED) {
+        (*p_len) = p_field->array_fixed_f.len;
+        return STATUS_SUCCESS;
+    }
+
+    for(size_t i = 0; i < index; i++) {
+        if(p_fields[i].field_type == LEN && p_fields[i].len_f.offset == p_field->array_variable_f.len_offset) {
+            Register_T reg;
+            Status_T   result = Load(&p_fields[i], p_stream, p_offsets[i], &reg);
+
+            (*p_len) = (size_t) reg.bits;
+            return result;
+        }
+    }
+
+    return ERROR_DESCRIPTOR_INVALID;
+}
+
+static Status_T Load(const BitField_T * p_field, Stream_T * p_stream, size_t bit_index, Register_T * p_register) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_register != NULL);
+
+    Stream_T stream = *p_stream;
+    Status_T result = Stream_SeekBit(&stream, bit_index);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    Value_T value;
+    result = BitParser_DeserializeValue(p_field, &value, &stream);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    p_register->is_real   = false;
+    p_register->is_signed = false;
+    p_register->real      = 0.0;
+
+    switch(p_field->field_type) {
+        case U8:  p_register->bits = value.u8;  break;
+        case U16: p_register->bits = value.u16; break;
+        case U32: p_register->bits = value.u32; break;
+        case U64: p_register->bits = value.u64; break;
+        case LEN: p_register->bits = value.len; break;
+
+        case I8:
+        case S8:  p_register->bits = (uint64_t) (int64_t) value.i8;  p_register->is_signed = true; break;
+        case I16:
+        case S16: p_register->bits = (uint64_t) (int64_t) value.i16; p_register->is_signed = true; break;
+        case I32:
+        case S32: p_register->bits = (uint64_t) (int64_t) value.i32; p_register->is_signed = true; break;
+        case I64:
+        case S64: p_register->bits = (uint64_t) value.i64;           p_register->is_signed = true; break;
+
+        case FLOAT:  p_register->real = value.f; p_register->is_real = true; break;
+        case DOUBLE: p_register->real = value.d; p_register->is_real = true; break;
+
+        default:
+            ASSERT(false);
+            return ERROR_DESCRIPTOR_INVALID;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static Status_T Store(const BitField_T * p_field, const Register_T * p_register, Stream_T * p_stream) {
+    ASSERT(p_field != NULL);
+    ASSERT(p_register != NULL);
+    ASSERT(p_stream != NULL);
+
+    double   real    = p_register->is_real   ? p_register->real
+                     : p_register->is_signed ? (double) (int64_t) p_register->bits
+                                             : (double) p_register->bits;
+    uint64_t integer = p_register->is_real   ? Saturate(p_register->real, IsSigned(p_field),
+                                                        BitParser_GetValueSize(p_field))
+                                             : p_register->bits;
+    Value_T value;
+
+    switch(p_field->field_type) {
+        case U8:  value.u8  = (uint8_t)  integer; break;
+        case U16: value.u16 = (uint16_t) integer; break;
+        case U32: value.u32 = (uint32_t) integer; break;
+        case U64: value.u64 = (uint64_t) integer; break;
+        case LEN: value.len = (size_t)   integer; break;
+
+        case I8:
+        case S8:  value.i8  = (int8_t)  integer; break;
+        case I16:
+        case S16: value.i16 = (int16_t) integer; break;
+        case I32:
+        case S32: value.i32 = (int32_t) integer; break;
+        case I64:
+        case S64: value.i64 = (int64_t) integer; break;
+
+        case FLOAT:  value.f = (float) real; break;
+        case DOUBLE: value.d = real;         break;
+
+        default:
+            ASSERT(false);
+            return ERROR_DESCRIPTOR_INVALID;
+    }
+
+    return BitParser_SerializeValue(p_field, &value, p_stream);
+}
+
+static Status_T Blit(Stream_T * p_source, size_t source_len, Stream_T * p_target, size_t target_len) {
+    ASSERT(p_source != NULL);
+    ASSERT(p_target != NULL);
+
+    uint8_t chunk[CHUNK_LEN];
+    size_t  copied = 0;
+
+    while(copied < target_len) {
+        size_t len  = target_len - copied < CHUNK_LEN ? target_len - copied : CHUNK_LEN;
+        size_t read = copied < source_len ? (source_len - copied < len ? source_len - copied : len) : 0;
+
+        memset(chunk + read, 0, len - read);
+
+        Status_T result = read != 0 ? Array_DeserializeBit(chunk, read, p_source) : STATUS_SUCCESS;
+        if(result != STATUS_SUCCESS)
+            return result;
+
+        result = Array_SerializeBit(chunk, len, p_target);
+        if(result != STATUS_SUCCESS)
+            return result;
+
+        copied += len;
+    }
+
+    return STATUS_SUCCESS;
+}
+
+static bool IsScalar(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    switch(p_field->field_type) {
+        case U8:
+        case I8:
+        case S8:
+        case U16:
+        case I16:
+        case S16:
+        case U32:
+        case I32:
+        case S32:
+        case U64:
+        case I64:
+        case S64:
+        case FLOAT:
+        case DOUBLE:
+        case LEN:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static bool IsArray(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    return p_field->field_type == ARRAY_FIXED || p_field->field_type == ARRAY_VARIABLE;
+}
+
+static bool IsSigned(const BitField_T * p_field) {
+    ASSERT(p_field != NULL);
+
+    switch(p_field->field_type) {
+        case I8:
+        case S8:
+        case I16:
+        case S16:
+        case I32:
+        case S32:
+        case I64:
+        case S64:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+static uint64_t Saturate(double real, bool is_signed, size_t size) {
+    size_t bits  = size * BITS_IN_BYTE;
+    double limit = 2.0 * (double) ((uint64_t) 1 << (bits - 1));
+
+    if(isnan(real))
+        return 0;
+
+    if(is_signed) {
+        uint64_t min = (uint64_t) 0 - ((uint64_t) 1 << (bits - 1));
+
+        if(real >= limit / 2.0)
+            return ~min;
+        if(real < -limit / 2.0)
+            return min;
+
+        return (uint64_t) (int64_t) real;
+    }
+
+    if(real >= limit)
+        return UINT64_MAX >> (sizeof(uint64_t) * BITS_IN_BYTE - bits);
+    if(real <= -1.0)
+        return 0;
+
+    return (uint64_t) real;
+}
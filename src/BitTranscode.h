@@ -0,0 +1,78 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_TRANSCODE_H
+#define BIT_TRANSCODE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+/**
+ * Field map entry of a target field with no source field. Such value fields are written as zero.
+ */
+#define BIT_TRANSCODE_NONE SIZE_MAX
+
+/**
+ * Transcode message from source stream into target stream described by another descriptor, without
+ * an intermediate message struct.
+ *
+ * Source field offsets are resolved first, then target fields are written in order, each taking its
+ * value from the source field given by the field map. Values are moved through a register and converted
+ * between field types and widths the same way as C assignment would convert them, except that FLOAT and
+ * DOUBLE values written to integer fields saturate at the range of the field type and NaN is written as
+ * zero. Arrays are copied directly between streams in chunks, an ARRAY_FIXED target is truncated or zero
+ * padded to its length. Target LEN fields shall be mapped to source LEN fields of corresponding arrays.
+ *
+ * Supported fields are integer, FLOAT, DOUBLE, LEN, ARRAY_FIXED, ARRAY_VARIABLE, ALIGN and PAD. Nested
+ * descriptors shall be flattened with BitParser_Flatten first.
+ *
+ * @param p_source_fields   Source message descriptor.
+ * @param no_source_fields  Number of fields in source descriptor.
+ * @param p_source          Source stream, moved past the source message on success.
+ * @param p_target_fields   Target message descriptor.
+ * @param no_target_fields  Number of fields in target descriptor.
+ * @param p_target          Target stream.
+ * @param p_map             Index of source field for every target field or BIT_TRANSCODE_NONE. Ignored for
+ *                          ALIGN and PAD target fields.
+ * @param p_offsets         Storage for no_source_fields + 1 source field bit offsets.
+ * @return                  Status. ERROR_DESCRIPTOR_INVALID if descriptors or map are not supported.
+ */
+Status_T BitTranscode_Message(const BitField_T * p_source_fields, size_t no_source_fields, Stream_T * p_source,
+                              const BitField_T * p_target_fields, size_t no_target_fields, Stream_T * p_target,
+                              const size_t * p_map, size_t * p_offsets);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //BIT_TRANSCODE_H
@@ -0,0 +1,146 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "BitView.h"
+#include "BitParserError.h"
+
+/**
+ * Resolve offsets of all fields up to the given one.
+ *
+ * @param p_self    Pointer to view object.
+ * @param index     Index of field in descriptor, up to number of fields.
+ * @return          Status.
+ */
+static Status_T Resolve(BitView_T * p_self, size_t index);
+
+void BitView_Init(BitView_T * p_self, const BitField_T * p_fields, size_t no_fields, void * data,
+                  Stream_T * p_stream, size_t * p_offsets, uint8_t * p_decoded) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_fields != NULL);
+    ASSERT(data != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(p_offsets != NULL);
+    ASSERT(p_decoded != NULL);
+
+    p_self->p_fields    = p_fields;
+    p_self->no_fields   = no_fields;
+    p_self->data        = data;
+    p_self->stream      = *p_stream;
+    p_self->p_offsets   = p_offsets;
+    p_self->no_resolved = 1;
+    p_self->p_decoded   = p_decoded;
+
+    p_offsets[0] = Stream_TellBit(p_stream);
+    memset(p_decoded, 0, BIT_VIEW_DECODED_SIZE(no_fields));
+}
+
+Status_T BitView_Get(BitView_T * p_self, size_t index) {
+    ASSERT(p_self != NULL);
+    ASSERT(index < p_self->no_fields);
+
+    if(BitView_IsDecoded(p_self, index))
+        return STATUS_SUCCESS;
+
+    #ifdef BIT_FIELD_UNION_ENABLED
+    if(p_self->p_fields[index].field_type == UNION) {
+        size_t tag = BitParser_FindUnionTag(p_self->p_fields, index);
+        if(tag != index) {
+            Status_T result = BitView_Get(p_self, tag);
+            if(result != STATUS_SUCCESS)
+                return result;
+        }
+    }
+    #endif
+
+    Status_T result = Resolve(p_self, index);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    result = Stream_SeekBit(&p_self->stream, p_self->p_offsets[index]);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    Stream_T frame;
+    Stream_OpenFrame(&frame, &p_self->stream, p_self->p_offsets[0]);
+
+    result = BitParser_DeserializeField(&p_self->p_fields[index], p_self->data, &frame);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    BIT_PARSER_MASK_SET(p_self->p_decoded, index);
+    return STATUS_SUCCESS;
+}
+
+bool BitView_IsDecoded(BitView_T * p_self, size_t index) {
+    ASSERT(p_self != NULL);
+    ASSERT(index < p_self->no_fields);
+
+    return BIT_PARSER_MASK_IS_SET(p_self->p_decoded, index);
+}
+
+Status_T BitView_GetOffsetBit(BitView_T * p_self, size_t index, size_t * p_bit_index) {
+    ASSERT(p_self != NULL);
+    ASSERT(index <= p_self->no_fields);
+    ASSERT(p_bit_index != NULL);
+
+    Status_T result = Resolve(p_self, index);
+    if(result != STATUS_SUCCESS)
+        return result;
+
+    (*p_bit_index) = p_self->p_offsets[index];
+    return STATUS_SUCCESS;
+}
+
+/*======================================================================================*/
+/*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
+/*======================================================================================*/
+
+static Status_T Resolve(BitView_T * p_self, size_t index) {
+    ASSERT(p_self != NULL);
+
+    while(p_self->no_resolved <= index) {
+        size_t             i       = p_self->no_resolved - 1;
+        const BitField_T * p_field = &p_self->p_fields[i];
+
+        if(p_field->field_type == LEN || p_field->field_type == SUBMSG || p_field->field_type == UNION ||
+           p_field->field_type == REPEATED) {
+            Status_T result = BitView_Get(p_self, i);
+            if(result != STATUS_SUCCESS)
+                return result;
+        }
+
+        size_t offset = p_self->p_offsets[i];
+        size_t next   = offset + BitParser_GetMessageFieldLengthBit(p_self->p_fields, i, p_self->data, offset);
+        if(next > Stream_GetSizeBits(&p_self->stream))
+            return ERROR_STREAM_TOO_SHORT;
+
+        p_self->p_offsets[i + 1] = next;
+        p_self->no_resolved++;
+    }
+
+    return STATUS_SUCCESS;
+}
@@ -0,0 +1,114 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#ifndef BIT_VIEW_H
+#define BIT_VIEW_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+/**
+ * Number of bytes of decoded fields bitmap needed for a descriptor with no_fields fields.
+ */
+#define BIT_VIEW_DECODED_SIZE(no_fields) BIT_PARSER_MASK_SIZE(no_fields)
+
+/**
+ * Lazy view of a serialized message.
+ *
+ * View decodes single fields on demand instead of the whole message. Bit offsets of fields are
+ * resolved once and incrementally, only as far as the furthest requested field. LEN, SUBMSG, UNION and
+ * REPEATED fields passed on the way are decoded, because offsets of following fields may depend on them,
+ * and so are tag fields of UNION fields.
+ * Decoded values are stored in the message struct, which serves as a cache, so every field is decoded at
+ * most once.
+ * View does not allocate any memory, storage for offsets and decoded fields bitmap is provided by the caller.
+ */
+typedef struct {
+    const BitField_T * p_fields;     /*!< Bit field message descriptor. */
+    size_t             no_fields;    /*!< Number of fields in descriptor. */
+    void *             data;         /*!< Structure receiving decoded fields. */
+    Stream_T           stream;       /*!< Own copy of a stream with the message. */
+    size_t *           p_offsets;    /*!< Stream bit index of each field, no_fields + 1 entries. */
+    size_t             no_resolved;  /*!< Number of valid entries in p_offsets. */
+    uint8_t *          p_decoded;    /*!< Decoded fields bitmap, BIT_VIEW_DECODED_SIZE(no_fields) bytes. */
+} BitView_T;
+
+/**
+ * Initialize view of a message starting at current position of a stream.
+ * Stream is copied, so the original stream is not moved by the view.
+ *
+ * @param p_self        Pointer to allocated view object.
+ * @param p_fields      Bit field message descriptor.
+ * @param no_fields     Number of fields in descriptor.
+ * @param data          Structure receiving decoded fields.
+ * @param p_stream      Stream with the message.
+ * @param p_offsets     Storage for no_fields + 1 field offsets.
+ * @param p_decoded     Storage for BIT_VIEW_DECODED_SIZE(no_fields) bytes of decoded fields bitmap.
+ */
+void BitView_Init(BitView_T * p_self, const BitField_T * p_fields, size_t no_fields, void * data,
+                  Stream_T * p_stream, size_t * p_offsets, uint8_t * p_decoded);
+
+/**
+ * Decode a single field into the message struct, unless it has been decoded already.
+ *
+ * @param p_self    Pointer to view object.
+ * @param index     Index of field in descriptor.
+ * @return          Status.
+ */
+Status_T BitView_Get(BitView_T * p_self, size_t index);
+
+/**
+ * Check if a field has been decoded already.
+ *
+ * @param p_self    Pointer to view object.
+ * @param index     Index of field in descriptor.
+ * @return          True if decoded.
+ */
+bool BitView_IsDecoded(BitView_T * p_self, size_t index);
+
+/**
+ * Get stream bit index at which a field starts.
+ * Passing index equal to number of fields gives the bit index right after the message.
+ *
+ * @param p_self        Pointer to view object.
+ * @param index         Index of field in descriptor.
+ * @param p_bit_index   Output bit index.
+ * @return              Status.
+ */
+Status_T BitView_GetOffsetBit(BitView_T * p_self, size_t index, size_t * p_bit_index);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif //BIT_VIEW_H
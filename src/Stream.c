@@ -64,7 +64,7 @@ void Stream_Init(Stream_T * p_self, uint8_t * p_buffer, size_t len, Stream_Mode_
     ASSERT(p_self != NULL);
     ASSERT(p_self != NULL);
     ASSERT(len != 0);
-    ASSERT(mode == LITTLE || mode == BIG);
+    ASSERT(STREAM_MODE_ENABLED(mode));
 
     p_self->p_buffer  = p_buffer;
     p_self->bit_len   = len * BITS_IN_BYTE;
@@ -80,7 +80,7 @@ Stream_Mode_T Stream_GetMode(Stream_T * p_self) {
 
 Status_T Stream_SetMode(Stream_T * p_self, Stream_Mode_T mode) {
     ASSERT(p_self != NULL);
-    ASSERT(mode == LITTLE || mode == BIG);
+    ASSERT(STREAM_MODE_ENABLED(mode));
 
     if(p_self->mode == mode)
         return STATUS_SUCCESS;
@@ -177,6 +177,48 @@ void Stream_Align(Stream_T * p_self) {
     p_self->bit_index += bit_in_byte != 0 ? BITS_IN_BYTE - bit_in_byte : 0;
 }
 
+void Stream_Checkpoint(Stream_T * p_self, Stream_Checkpoint_T * p_checkpoint) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_checkpoint != NULL);
+
+    p_checkpoint->bit_index = p_self->bit_index;
+    p_checkpoint->boundary  = Stream_Tell(p_self) < Stream_GetSize(p_self) ? p_self->p_buffer[Stream_Tell(p_self)] : 0;
+}
+
+void Stream_Restore(Stream_T * p_self, const Stream_Checkpoint_T * p_checkpoint) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_checkpoint != NULL);
+    ASSERT(p_checkpoint->bit_index <= p_self->bit_index);
+
+    size_t first = BYTE_INDEX(p_checkpoint->bit_index);
+
+    if(first < Stream_GetSize(p_self))
+        p_self->p_buffer[first] = p_checkpoint->boundary;
+
+    p_self->bit_index = p_checkpoint->bit_index;
+}
+
+void Stream_OpenFrame(Stream_T * p_self, const Stream_T * p_stream, size_t start_bit) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_stream != NULL);
+    ASSERT(start_bit <= p_stream->bit_index);
+
+    size_t base = BYTE_INDEX(start_bit) * BITS_IN_BYTE;
+
+    p_self->p_buffer  = p_stream->p_buffer + BYTE_INDEX(start_bit);
+    p_self->bit_len   = p_stream->bit_len > base ? p_stream->bit_len - base : 0;
+    p_self->bit_index = p_stream->bit_index - base;
+    p_self->mode      = p_stream->mode;
+}
+
+void Stream_CloseFrame(Stream_T * p_self, const Stream_T * p_frame) {
+    ASSERT(p_self != NULL);
+    ASSERT(p_frame != NULL);
+    ASSERT(p_frame->p_buffer >= p_self->p_buffer);
+
+    p_self->bit_index = (size_t) (p_frame->p_buffer - p_self->p_buffer) * BITS_IN_BYTE + p_frame->bit_index;
+}
+
 Status_T Stream_Write(Stream_T * p_self, uint8_t * p_data, size_t len) {
     ASSERT(p_self != NULL);
     ASSERT(p_data != NULL);
@@ -200,7 +242,7 @@ Status_T Stream_WriteBit(Stream_T * p_self, uint8_t * p_data, size_t bit_len) {
         return ERROR_STREAM_TOO_SHORT;
 
     size_t offset = 0;
-    if(bit_len % BITS_IN_BYTE != 0 && p_self->mode == BIG)
+    if(bit_len % BITS_IN_BYTE != 0 && !STREAM_MODE_IS_LITTLE(p_self->mode))
         offset += BITS_IN_BYTE - (bit_len % BITS_IN_BYTE);
 
     for(size_t foreign_index = offset; foreign_index < bit_len + offset;) {
@@ -243,7 +285,7 @@ Status_T Stream_ReadBit(Stream_T * p_self, uint8_t * p_data, size_t bit_len) {
         return ERROR_STREAM_TOO_SHORT;
 
     size_t offset = 0;
-    if(bit_len % BITS_IN_BYTE != 0 && p_self->mode == BIG)
+    if(bit_len % BITS_IN_BYTE != 0 && !STREAM_MODE_IS_LITTLE(p_self->mode))
         offset += BITS_IN_BYTE - (bit_len % BITS_IN_BYTE);
 
     for(size_t foreign_index = offset; foreign_index < bit_len + offset;) {
@@ -276,8 +318,8 @@ static void Stream_WritePartByte(uint8_t *p_dst, uint8_t value, size_t index, si
     ASSERT(p_dst != NULL);
 
     index %= BITS_IN_BYTE;
-    size_t  start_index = mode == LITTLE ? index : BITS_IN_BYTE - index - bit_count;
-    size_t  end_index   = mode == LITTLE ? index + bit_count : BITS_IN_BYTE - index;
+    size_t  start_index = STREAM_MODE_IS_LITTLE(mode) ? index : BITS_IN_BYTE - index - bit_count;
+    size_t  end_index   = STREAM_MODE_IS_LITTLE(mode) ? index + bit_count : BITS_IN_BYTE - index;
     uint8_t mask        = Stream_GetMask(start_index, end_index);
 
     (*p_dst) &= (uint8_t) (~mask);
@@ -286,8 +328,8 @@ static void Stream_WritePartByte(uint8_t *p_dst, uint8_t value, size_t index, si
 
 static uint8_t Stream_ReadPartByte(uint8_t value, size_t index, size_t bit_count, Stream_Mode_T mode) {
     index %= BITS_IN_BYTE;
-    size_t  start_index = mode == LITTLE ? index : BITS_IN_BYTE - index - bit_count;
-    size_t  end_index   = mode == LITTLE ? index + bit_count : BITS_IN_BYTE - index;
+    size_t  start_index = STREAM_MODE_IS_LITTLE(mode) ? index : BITS_IN_BYTE - index - bit_count;
+    size_t  end_index   = STREAM_MODE_IS_LITTLE(mode) ? index + bit_count : BITS_IN_BYTE - index;
     uint8_t mask        = Stream_GetMask(start_index, end_index);
 
     return (uint8_t) ((value & mask) >> BIT_IN_BYTE(start_index));
@@ -47,6 +47,21 @@ typedef enum {
     LITTLE  /*!< Stream in little endian mode. Least significant bits are considered first. */
 } Stream_Mode_T;
 
+/*
+ * Stream mode checks. When only one mode is compiled in they are constant, so the other mode code paths
+ * are removed by the compiler.
+ */
+#if defined(BIT_PARSER_MODE_BIG_ENABLED) && defined(BIT_PARSER_MODE_LITTLE_ENABLED)
+#define STREAM_MODE_IS_LITTLE(mode) ((mode) == LITTLE)
+#define STREAM_MODE_ENABLED(mode)   ((mode) == LITTLE || (mode) == BIG)
+#elif defined(BIT_PARSER_MODE_LITTLE_ENABLED)
+#define STREAM_MODE_IS_LITTLE(mode) ((void) (mode), 1)
+#define STREAM_MODE_ENABLED(mode)   ((mode) == LITTLE)
+#else
+#define STREAM_MODE_IS_LITTLE(mode) ((void) (mode), 0)
+#define STREAM_MODE_ENABLED(mode)   ((mode) == BIG)
+#endif
+
 /**
  *  Stream is a data structure describing binary read and write stream.
  *
@@ -62,6 +77,14 @@ typedef struct {
     Stream_Mode_T mode;         /*!< Stream mode */
 } Stream_T;
 
+/**
+ * Stream checkpoint, ie. saved stream position with content of the byte it points to.
+ */
+typedef struct {
+    size_t  bit_index;  /*!< Saved bit index. */
+    uint8_t boundary;   /*!< Saved content of the byte at bit index. */
+} Stream_Checkpoint_T;
+
 /**
  * Initialize stream.
  *
@@ -192,6 +215,43 @@ size_t Stream_TellBitInByte(Stream_T * p_self);
  */
 void Stream_Align(Stream_T * p_self);
 
+/**
+ * Save stream position and content of the byte it points to, which may be partially overwritten by
+ * following writes.
+ *
+ * @param p_self        Pointer to stream object.
+ * @param p_checkpoint  Output checkpoint.
+ */
+void Stream_Checkpoint(Stream_T * p_self, Stream_Checkpoint_T * p_checkpoint);
+
+/**
+ * Roll stream back to a checkpoint. Stream position and the boundary byte are restored, bytes following
+ * the boundary byte are left as written, they are overwritten by further writes. Stream shall not be
+ * moved back before checkpoint in the meantime.
+ *
+ * @param p_self        Pointer to stream object.
+ * @param p_checkpoint  Checkpoint.
+ */
+void Stream_Restore(Stream_T * p_self, const Stream_Checkpoint_T * p_checkpoint);
+
+/**
+ * Initialize frame, ie. stream over the same buffer starting at the byte holding given bit of another stream.
+ * Frame is positioned at the current bit of the stream, its byte indexes count from the start of frame.
+ *
+ * @param p_self        Pointer to allocated frame object.
+ * @param p_stream      Stream, its current bit shall not precede start_bit.
+ * @param start_bit     Bit index in stream of the first bit covered by frame.
+ */
+void Stream_OpenFrame(Stream_T * p_self, const Stream_T * p_stream, size_t start_bit);
+
+/**
+ * Move stream to the current position of a frame opened over it.
+ *
+ * @param p_self        Pointer to stream object.
+ * @param p_frame       Frame opened over the stream with Stream_OpenFrame.
+ */
+void Stream_CloseFrame(Stream_T * p_self, const Stream_T * p_frame);
+
 /**
  * Writes data to a stream.
  * This function automatically aligns index before writing.
@@ -31,6 +31,7 @@
 #define GET_BYTE(data, i)    ((uint8_t) ((data) >> ((i) * 8)))
 #define CREATE_BYTE(data, i) (((uint64_t) (data)) << ((i) * 8))
 
+#ifdef BIT_PARSER_BYTE_API_ENABLED
 /**
  * Write data into a stream.
  * This function aligns stream index before writing.
@@ -85,7 +86,9 @@ static Status_T SerializeBE(uint64_t value, size_t byte_count, Stream_T * p_stre
  * @return              Status.
  */
 static Status_T SerializeLE(uint64_t value, size_t byte_count, Stream_T * p_stream);
+#endif
 
+#ifdef BIT_PARSER_BIT_API_ENABLED
 /**
  * Write data into stream.
  *
@@ -156,7 +159,9 @@ static Status_T SerializeBitBE(uint64_t value, size_t byte_count, size_t bit_wid
  * @return           Status.
  */
 static Status_T SerializeBitLE(uint64_t value, size_t byte_count, size_t bit_width, Stream_T * p_stream);
+#endif
 
+#ifdef BIT_PARSER_BYTE_API_ENABLED
 /**
  * Reads data from a stream.
  * This function aligns stream index before reading.
@@ -211,7 +216,9 @@ static Status_T DeserializeBE(uint64_t * p_output, size_t byte_count, Stream_T *
  * @return              Status.
  */
 static Status_T DeserializeLE(uint64_t * p_output, size_t byte_count, Stream_T * p_stream);
+#endif
 
+#ifdef BIT_PARSER_BIT_API_ENABLED
 /**
  * Read data from a stream.
  *
@@ -282,228 +289,232 @@ static Status_T DeserializeBitLE(uint64_t * p_data, size_t byte_count, size_t bi
  * @return              Status.
  */
 static Status_T DeserializeBitBE(uint64_t * p_data, size_t byte_count, size_t bit_width, Stream_T * p_stream);
+#endif
 
+#ifdef BIT_PARSER_BYTE_API_ENABLED
 Status_T U8_Serialize(uint8_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return Serialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T I8_Serialize(int8_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return ISerialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T S8_Serialize(int8_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SSerialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T U16_Serialize(uint16_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return Serialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T I16_Serialize(int16_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return ISerialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T S16_Serialize(int16_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SSerialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T U32_Serialize(uint32_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return Serialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T I32_Serialize(int32_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return ISerialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T S32_Serialize(int32_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SSerialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T U64_Serialize(uint64_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return Serialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T I64_Serialize(int64_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return ISerialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T S64_Serialize(int64_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SSerialize(*p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T Float_Serialize(float * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return U32_Serialize((uint32_t *) p_data, p_stream);
 }
 
 Status_T Double_Serialize(double * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return U64_Serialize((uint64_t *) p_data, p_stream);
 }
 
 Status_T Size_Serialize(size_t * p_data, size_t byte_size, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return Serialize(*p_data, byte_size, p_stream);
 }
 
 Status_T Array_Serialize(uint8_t * p_data, size_t len, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     Stream_Align(p_stream);
     return Stream_Write(p_stream, p_data, len);
 }
+#endif
 
+#ifdef BIT_PARSER_BIT_API_ENABLED
 Status_T U8_SerializeBit(uint8_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T I8_SerializeBit(int8_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return ISerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T S8_SerializeBit(int8_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SSerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T U16_SerializeBit(uint16_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T I16_SerializeBit(int16_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return ISerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T S16_SerializeBit(int16_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SSerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T U32_SerializeBit(uint32_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T I32_SerializeBit(int32_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return ISerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T S32_SerializeBit(int32_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SSerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T U64_SerializeBit(uint64_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T I64_SerializeBit(int64_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return ISerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T S64_SerializeBit(int64_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SSerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T Float_SerializeBit(float * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return U32_SerializeBit((uint32_t *) p_data, sizeof(*p_data) * BITS_IN_BYTE, p_stream);
 }
 
 Status_T Double_SerializeBit(double * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return U64_SerializeBit((uint64_t *) p_data, sizeof(*p_data) * BITS_IN_BYTE, p_stream);
 }
 
 Status_T Size_SerializeBit(size_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SerializeBit(*p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T Array_SerializeBit(uint8_t * p_data, size_t data_len, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     if(Stream_GetLeftBits(p_stream) < data_len * BITS_IN_BYTE)
         return ERROR_STREAM_TOO_SHORT;
@@ -516,24 +527,26 @@ Status_T Array_SerializeBit(uint8_t * p_data, size_t data_len, Stream_T * p_stre
 
     return STATUS_SUCCESS;
 }
+#endif
 
+#ifdef BIT_PARSER_BYTE_API_ENABLED
 Status_T U8_Deserialize(uint8_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return Stream_Read(p_stream, p_data, sizeof(uint8_t));
 }
 
 Status_T I8_Deserialize(int8_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return Stream_Read(p_stream, (uint8_t *) p_data, sizeof(uint8_t));
 }
 
 Status_T S8_Deserialize(int8_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t data;
     Status_T result = SDeserialize(&data, sizeof(*p_data), p_stream);
@@ -545,8 +558,8 @@ Status_T S8_Deserialize(int8_t * p_data, Stream_T * p_stream) {
 }
 
 Status_T U16_Deserialize(uint16_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t data;
     Status_T result = Deserialize(&data, sizeof(*p_data), p_stream);
@@ -558,8 +571,8 @@ Status_T U16_Deserialize(uint16_t * p_data, Stream_T * p_stream) {
 }
 
 Status_T I16_Deserialize(int16_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t data;
     Status_T result = IDeserialize(&data, sizeof(*p_data), p_stream);
@@ -571,8 +584,8 @@ Status_T I16_Deserialize(int16_t * p_data, Stream_T * p_stream) {
 }
 
 Status_T S16_Deserialize(int16_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t data;
     Status_T result = SDeserialize(&data, sizeof(*p_data), p_stream);
@@ -584,8 +597,8 @@ Status_T S16_Deserialize(int16_t * p_data, Stream_T * p_stream) {
 }
 
 Status_T U32_Deserialize(uint32_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t data;
     Status_T result = Deserialize(&data, sizeof(*p_data), p_stream);
@@ -597,8 +610,8 @@ Status_T U32_Deserialize(uint32_t * p_data, Stream_T * p_stream) {
 }
 
 Status_T I32_Deserialize(int32_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t data;
     Status_T result = IDeserialize(&data, sizeof(*p_data), p_stream);
@@ -610,8 +623,8 @@ Status_T I32_Deserialize(int32_t * p_data, Stream_T * p_stream) {
 }
 
 Status_T S32_Deserialize(int32_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t data;
     Status_T result = SDeserialize(&data, sizeof(*p_data), p_stream);
@@ -623,43 +636,43 @@ Status_T S32_Deserialize(int32_t * p_data, Stream_T * p_stream) {
 }
 
 Status_T U64_Deserialize(uint64_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return Deserialize(p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T I64_Deserialize(int64_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return IDeserialize(p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T S64_Deserialize(int64_t * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SDeserialize(p_data, sizeof(*p_data), p_stream);
 }
 
 Status_T Float_Deserialize(float * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return U32_Deserialize((uint32_t *) p_data, p_stream);
 }
 
 Status_T Double_Deserialize(double * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return U64_Deserialize((uint64_t *) p_data, p_stream);
 }
 
 Status_T Size_Deserialize(size_t * p_data, size_t byte_size, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t value;
     Status_T result = Deserialize(&value, byte_size, p_stream);
@@ -672,15 +685,17 @@ Status_T Size_Deserialize(size_t * p_data, size_t byte_size, Stream_T * p_stream
 }
 
 Status_T Array_Deserialize(uint8_t * p_data, size_t len, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return Stream_Read(p_stream, p_data, len);
 }
+#endif
 
+#ifdef BIT_PARSER_BIT_API_ENABLED
 Status_T U8_DeserializeBit(uint8_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t value;
     Status_T result = DeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -693,8 +708,8 @@ Status_T U8_DeserializeBit(uint8_t * p_data, size_t bit_width, Stream_T * p_stre
 }
 
 Status_T I8_DeserializeBit(int8_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t value;
     Status_T result = IDeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -707,8 +722,8 @@ Status_T I8_DeserializeBit(int8_t * p_data, size_t bit_width, Stream_T * p_strea
 }
 
 Status_T S8_DeserializeBit(int8_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t value;
     Status_T result = SDeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -721,8 +736,8 @@ Status_T S8_DeserializeBit(int8_t * p_data, size_t bit_width, Stream_T * p_strea
 }
 
 Status_T U16_DeserializeBit(uint16_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t value;
     Status_T result = DeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -735,8 +750,8 @@ Status_T U16_DeserializeBit(uint16_t * p_data, size_t bit_width, Stream_T * p_st
 }
 
 Status_T I16_DeserializeBit(int16_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t value;
     Status_T result = IDeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -749,8 +764,8 @@ Status_T I16_DeserializeBit(int16_t * p_data, size_t bit_width, Stream_T * p_str
 }
 
 Status_T S16_DeserializeBit(int16_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t value;
     Status_T result = SDeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -763,8 +778,8 @@ Status_T S16_DeserializeBit(int16_t * p_data, size_t bit_width, Stream_T * p_str
 }
 
 Status_T U32_DeserializeBit(uint32_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t value;
     Status_T result = DeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -777,8 +792,8 @@ Status_T U32_DeserializeBit(uint32_t * p_data, size_t bit_width, Stream_T * p_st
 }
 
 Status_T I32_DeserializeBit(int32_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t value;
     Status_T result = IDeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -791,8 +806,8 @@ Status_T I32_DeserializeBit(int32_t * p_data, size_t bit_width, Stream_T * p_str
 }
 
 Status_T S32_DeserializeBit(int32_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     int64_t value;
     Status_T result = SDeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -805,43 +820,43 @@ Status_T S32_DeserializeBit(int32_t * p_data, size_t bit_width, Stream_T * p_str
 }
 
 Status_T U64_DeserializeBit(uint64_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return DeserializeBit(p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T I64_DeserializeBit(int64_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return IDeserializeBit(p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T S64_DeserializeBit(int64_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return SDeserializeBit(p_data, sizeof(*p_data), bit_width, p_stream);
 }
 
 Status_T Float_DeserializeBit(float * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return U32_DeserializeBit((uint32_t *) p_data, sizeof(*p_data) * BITS_IN_BYTE, p_stream);
 }
 
 Status_T Double_DeserializeBit(double * p_data, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     return U64_DeserializeBit((uint64_t *) p_data, sizeof(*p_data) * BITS_IN_BYTE, p_stream);
 }
 
 Status_T Size_DeserializeBit(size_t * p_data, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t value;
     Status_T result = DeserializeBit(&value, sizeof(*p_data), bit_width, p_stream);
@@ -854,8 +869,8 @@ Status_T Size_DeserializeBit(size_t * p_data, size_t bit_width, Stream_T * p_str
 }
 
 Status_T Array_DeserializeBit(uint8_t * p_data, size_t data_len, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     if(Stream_GetLeftBits(p_stream) < data_len * BITS_IN_BYTE)
         return ERROR_STREAM_TOO_SHORT;
@@ -867,22 +882,24 @@ Status_T Array_DeserializeBit(uint8_t * p_data, size_t data_len, Stream_T * p_st
 
     return result;
 }
+#endif
 
 /*======================================================================================*/
 /*                   ####### LOCAL FUNCTIONS DEFINITIONS #######                        */
 /*======================================================================================*/
 
+#ifdef BIT_PARSER_BYTE_API_ENABLED
 static Status_T Serialize(uint64_t value, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
-    if(Stream_GetMode(p_stream) == LITTLE)
+    if(STREAM_MODE_IS_LITTLE(Stream_GetMode(p_stream)))
         return SerializeLE(value, byte_count, p_stream);
     else
         return SerializeBE(value, byte_count, p_stream);
 }
 
 static Status_T ISerialize(int64_t value, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t x;
     memcpy(&x, &value, sizeof(value));
@@ -891,13 +908,13 @@ static Status_T ISerialize(int64_t value, size_t byte_count, Stream_T * p_stream
 }
 
 static Status_T SSerialize(int64_t value, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t x;
 
     if(value < 0) {
         x  = (uint64_t) (value * -1);
-        x |= (uint64_t) (1 << ((BITS_IN_BYTE * byte_count) - 1));
+        x |= (uint64_t) 1 << ((BITS_IN_BYTE * byte_count) - 1);
     }
     else {
         x = (uint64_t) value;
@@ -907,7 +924,7 @@ static Status_T SSerialize(int64_t value, size_t byte_count, Stream_T * p_stream
 }
 
 static Status_T SerializeBE(uint64_t value, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint8_t data[byte_count];
 
@@ -918,7 +935,7 @@ static Status_T SerializeBE(uint64_t value, size_t byte_count, Stream_T * p_stre
 }
 
 static Status_T SerializeLE(uint64_t value, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint8_t data[byte_count];
 
@@ -927,18 +944,20 @@ static Status_T SerializeLE(uint64_t value, size_t byte_count, Stream_T * p_stre
 
     return Stream_Write(p_stream, data, sizeof(data));
 }
+#endif
 
+#ifdef BIT_PARSER_BIT_API_ENABLED
 static Status_T SerializeBit(uint64_t value, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
-    if(Stream_GetMode(p_stream) == LITTLE)
+    if(STREAM_MODE_IS_LITTLE(Stream_GetMode(p_stream)))
         return SerializeBitLE(value, byte_count, bit_width, p_stream);
     else
         return SerializeBitBE(value, byte_count, bit_width, p_stream);
 }
 
 static Status_T ISerializeBit(int64_t value, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t x;
     memcpy(&x, &value, sizeof(value));
@@ -947,13 +966,13 @@ static Status_T ISerializeBit(int64_t value, size_t byte_count, size_t bit_width
 }
 
 static Status_T SSerializeBit(int64_t value, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t x;
 
     if(value < 0) {
         x  = (uint64_t) (value * -1);
-        x |= (uint64_t) (1 << (bit_width - 1));
+        x |= (uint64_t) 1 << (bit_width - 1);
     }
     else {
         x = (uint64_t) value;
@@ -963,7 +982,7 @@ static Status_T SSerializeBit(int64_t value, size_t byte_count, size_t bit_width
 }
 
 static Status_T SerializeBitLE(uint64_t value, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint8_t data[byte_count];
 
@@ -985,7 +1004,7 @@ static Status_T SerializeBitLE(uint64_t value, size_t byte_count, size_t bit_wid
 }
 
 static Status_T SerializeBitBE(uint64_t value, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint8_t data[byte_count];
 
@@ -1008,20 +1027,22 @@ static Status_T SerializeBitBE(uint64_t value, size_t byte_count, size_t bit_wid
     size_t bit_to_be_written = MIN(bit_width, BITS_IN_BYTE * sizeof(data));
     return Stream_WriteBit(p_stream, data + offset, bit_to_be_written);
 }
+#endif
 
+#ifdef BIT_PARSER_BYTE_API_ENABLED
 static Status_T Deserialize(uint64_t * p_output, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_output != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_output != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
-    if(Stream_GetMode(p_stream) == LITTLE)
+    if(STREAM_MODE_IS_LITTLE(Stream_GetMode(p_stream)))
         return DeserializeLE(p_output, byte_count, p_stream);
     else
         return DeserializeBE(p_output, byte_count, p_stream);
 }
 
 static Status_T IDeserialize(int64_t * p_output, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_output != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_output != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t x;
 
@@ -1035,8 +1056,8 @@ static Status_T IDeserialize(int64_t * p_output, size_t byte_count, Stream_T * p
 }
 
 static Status_T SDeserialize(int64_t * p_output, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_output != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_output != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t x;
 
@@ -1054,8 +1075,8 @@ static Status_T SDeserialize(int64_t * p_output, size_t byte_count, Stream_T * p
 }
 
 static Status_T DeserializeBE(uint64_t * p_output, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_output != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_output != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint8_t data[byte_count];
 
@@ -1071,8 +1092,8 @@ static Status_T DeserializeBE(uint64_t * p_output, size_t byte_count, Stream_T *
 }
 
 static Status_T DeserializeLE(uint64_t * p_output, size_t byte_count, Stream_T * p_stream) {
-    ASSERT(p_output != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_output != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint8_t data[byte_count];
 
@@ -1086,20 +1107,22 @@ static Status_T DeserializeLE(uint64_t * p_output, size_t byte_count, Stream_T *
 
     return STATUS_SUCCESS;
 }
+#endif
 
+#ifdef BIT_PARSER_BIT_API_ENABLED
 static Status_T DeserializeBit(uint64_t * p_data, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
-    if(Stream_GetMode(p_stream) == LITTLE)
+    if(STREAM_MODE_IS_LITTLE(Stream_GetMode(p_stream)))
         return DeserializeBitLE(p_data, byte_count, bit_width, p_stream);
     else
         return DeserializeBitBE(p_data, byte_count, bit_width, p_stream);
 }
 
 static Status_T IDeserializeBit(int64_t * p_data, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t x;
 
@@ -1109,8 +1132,8 @@ static Status_T IDeserializeBit(int64_t * p_data, size_t byte_count, size_t bit_
 
     uint64_t mask = (uint64_t) 1 << (bit_width - 1);
 
-    if(x & mask)
-        x |= (uint64_t) 0xFF << bit_width;
+    if((x & mask) && (bit_width < (sizeof(x) * BITS_IN_BYTE)))
+        x |= UINT64_MAX << bit_width;
 
     memcpy(p_data, &x, byte_count);
 
@@ -1118,8 +1141,8 @@ static Status_T IDeserializeBit(int64_t * p_data, size_t byte_count, size_t bit_
 }
 
 static Status_T SDeserializeBit(int64_t * p_data, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint64_t x;
 
@@ -1137,8 +1160,8 @@ static Status_T SDeserializeBit(int64_t * p_data, size_t byte_count, size_t bit_
 }
 
 static Status_T DeserializeBitLE(uint64_t * p_data, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint8_t data[byte_count];
     memset(data, 0, byte_count);
@@ -1164,8 +1187,8 @@ static Status_T DeserializeBitLE(uint64_t * p_data, size_t byte_count, size_t bi
 }
 
 static Status_T DeserializeBitBE(uint64_t * p_data, size_t byte_count, size_t bit_width, Stream_T * p_stream) {
-    ASSERT(p_data != NULL);
-    ASSERT(p_stream != NULL);
+    ASSERT_HOT(p_data != NULL);
+    ASSERT_HOT(p_stream != NULL);
 
     uint8_t data[byte_count];
     memset(data, 0, byte_count);
@@ -1195,3 +1218,4 @@ static Status_T DeserializeBitBE(uint64_t * p_data, size_t byte_count, size_t bi
 
     return STATUS_SUCCESS;
 }
+#endif
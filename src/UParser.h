@@ -36,6 +36,7 @@ extern "C" {
 #include "Stream.h"
 #include "BitParserError.h"
 
+#ifdef BIT_PARSER_BYTE_API_ENABLED
 /**
  * Write uint8 data into a stream.
  * This function aligns stream index before writing.
@@ -195,7 +196,9 @@ Status_T Size_Serialize(size_t * p_data, size_t byte_size, Stream_T * p_stream);
  * @return          Status.
  */
 Status_T Array_Serialize(uint8_t * p_data, size_t len, Stream_T * p_stream);
+#endif
 
+#ifdef BIT_PARSER_BIT_API_ENABLED
 /**
  * Write uint8 data into stream. Writes only bit_width bits.
  *
@@ -508,7 +511,9 @@ Status_T Size_SerializeBit(size_t * p_data, size_t bit_width, Stream_T * p_strea
  * @return          Status.
  */
 Status_T Array_SerializeBit(uint8_t * p_data, size_t data_len, Stream_T * p_stream);
+#endif
 
+#ifdef BIT_PARSER_BYTE_API_ENABLED
 /**
  * Reads uint8 data from a stream.
  * This function aligns stream index before reading.
@@ -668,7 +673,9 @@ Status_T Size_Deserialize(size_t * p_data, size_t byte_size, Stream_T * p_stream
  * @return          Status.
  */
 Status_T Array_Deserialize(uint8_t * p_data, size_t len, Stream_T * p_stream);
+#endif
 
+#ifdef BIT_PARSER_BIT_API_ENABLED
 /**
  * Read uint8 data from a stream. Reads only bit_width bits.
  *
@@ -953,6 +960,7 @@ Status_T Size_DeserializeBit(size_t * p_data, size_t bit_width, Stream_T * p_str
  * @return          Status.
  */
 Status_T Array_DeserializeBit(uint8_t * p_data, size_t data_len, Stream_T * p_stream);
+#endif
 
 #ifdef __cplusplus
 }
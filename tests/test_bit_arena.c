@@ -0,0 +1,66 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include "unity.h"
+
+#include "BitArena.h"
+
+void test_arena_alloc(void) {
+    //Given
+    _Alignas(8) uint8_t memory[16];
+    BitArena_T arena;
+    BitArena_Init(&arena, memory, sizeof(memory));
+
+    //When
+    uint8_t *  p_byte  = BitArena_Alloc(&arena, 1, 1);
+    uint64_t * p_value = BitArena_Alloc(&arena, sizeof(uint64_t), _Alignof(uint64_t));
+    void *     p_full  = BitArena_Alloc(&arena, 1, 1);
+
+    //Then
+    TEST_ASSERT_EQUAL_PTR(&memory[0], p_byte);
+    TEST_ASSERT_EQUAL_PTR(&memory[8], p_value);
+    TEST_ASSERT_NULL(p_full);
+    TEST_ASSERT_EQUAL(16, BitArena_GetUsed(&arena));
+}
+
+void test_arena_rewind_and_reset(void) {
+    //Given
+    uint8_t    memory[16];
+    BitArena_T arena;
+    BitArena_Init(&arena, memory, sizeof(memory));
+    BitArena_Alloc(&arena, 4, 1);
+    size_t used = BitArena_GetUsed(&arena);
+    BitArena_Alloc(&arena, 8, 1);
+
+    //When
+    BitArena_Rewind(&arena, used);
+    void * p_rewound = BitArena_Alloc(&arena, 12, 1);
+    BitArena_Reset(&arena);
+    void * p_reset = BitArena_Alloc(&arena, 16, 1);
+
+    //Then
+    TEST_ASSERT_EQUAL_PTR(&memory[4], p_rewound);
+    TEST_ASSERT_EQUAL_PTR(&memory[0], p_reset);
+}
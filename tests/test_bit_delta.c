@@ -0,0 +1,111 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "BitDelta.h"
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+typedef struct {
+    uint16_t  temperature;
+    int8_t    rssi;
+    uint32_t  uptime;
+    uint8_t * id;
+    size_t    len;
+    uint8_t * log;
+} Telemetry_T;
+
+static const BitField_T telemetry_desc[] = {
+    BIT_FIELD_U16(12, Telemetry_T, temperature),
+    BIT_FIELD_I8(8, Telemetry_T, rssi),
+    BIT_FIELD_U32(32, Telemetry_T, uptime),
+    BIT_FIELD_PAD(4),
+    BIT_FIELD_ARRAY_FIXED(2, Telemetry_T, id),
+    BIT_FIELD_LEN(8, Telemetry_T, len),
+    BIT_FIELD_ARRAY_VARIABLE(Telemetry_T, log, len),
+};
+
+void test_delta_roundtrip(void) {
+    //Given
+    uint8_t id[]           = {0x12, 0x34};
+    uint8_t previous_log[] = {0xAA, 0xBB};
+    uint8_t current_log[]  = {0xAA, 0xCC};
+    uint8_t base_id[2]     = {0};
+    uint8_t base_log[2]    = {0};
+
+    Telemetry_T previous = {.temperature = 0x123, .rssi = -40, .uptime = 1000, .id = id, .len = 2, .log = previous_log};
+    Telemetry_T current  = {.temperature = 0x124, .rssi = -40, .uptime = 1000, .id = id, .len = 2, .log = current_log};
+    Telemetry_T base     = previous;
+    base.id  = base_id;
+    base.log = base_log;
+    memcpy(base_id, id, sizeof(id));
+    memcpy(base_log, previous_log, sizeof(previous_log));
+
+    uint8_t buffer[8] = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    Status_T serialize_result = BitDelta_Serialize(telemetry_desc, ARRAY_LEN(telemetry_desc), &current, &previous,
+                                                   &stream);
+    size_t delta_bit = Stream_TellBit(&stream);
+
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    Status_T deserialize_result = BitDelta_Deserialize(telemetry_desc, ARRAY_LEN(telemetry_desc), &base, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, serialize_result);
+    TEST_ASSERT_EQUAL(7 + 12 + 16, delta_bit);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, deserialize_result);
+    TEST_ASSERT_EQUAL(delta_bit, Stream_TellBit(&stream));
+    TEST_ASSERT_EQUAL_HEX16(0x124, base.temperature);
+    TEST_ASSERT_EQUAL(-40, base.rssi);
+    TEST_ASSERT_EQUAL(1000, base.uptime);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(id, base_id, sizeof(id));
+    TEST_ASSERT_EQUAL(2, base.len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(current_log, base_log, sizeof(current_log));
+}
+
+void test_delta_unchanged(void) {
+    //Given
+    uint8_t     id[]      = {0x12, 0x34};
+    uint8_t     log[]     = {0xAA};
+    Telemetry_T msg       = {.temperature = 0x123, .rssi = 5, .uptime = 7, .id = id, .len = 1, .log = log};
+    uint8_t     buffer[1] = {0xFF};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    Status_T result = BitDelta_Serialize(telemetry_desc, ARRAY_LEN(telemetry_desc), &msg, &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(ARRAY_LEN(telemetry_desc), Stream_TellBit(&stream));
+    TEST_ASSERT_EQUAL_HEX8(0x01, buffer[0]);
+}
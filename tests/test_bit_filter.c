@@ -0,0 +1,184 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "BitFilter.h"
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+#define NO_RECORDS 8
+#define RECORD_LEN 11
+
+typedef struct {
+    uint8_t  status;
+    uint16_t channel;
+    uint64_t time;
+    uint8_t  flags;
+} Record_T;
+
+static const BitField_T record_desc[] = {
+    BIT_FIELD_U8(4, Record_T, status),
+    BIT_FIELD_U16(12, Record_T, channel),
+    BIT_FIELD_PAD(3),
+    BIT_FIELD_U64(64, Record_T, time),
+    BIT_FIELD_U8(5, Record_T, flags),
+};
+
+static uint8_t    input[NO_RECORDS * RECORD_LEN];
+static BitBatch_T batch;
+
+static void make_records(Stream_Mode_T mode) {
+    memset(input, 0, sizeof(input));
+
+    for(size_t i = 0; i < NO_RECORDS; i++) {
+        Record_T record = {
+            .status  = (uint8_t) (i % 4),
+            .channel = (uint16_t) (i * 100),
+            .time    = 0xF123456789ABCDE0u + i,
+            .flags   = (uint8_t) (i * 3),
+        };
+        Stream_T stream;
+        Stream_Init(&stream, input + i * RECORD_LEN, RECORD_LEN, mode);
+        BitParser_Serialize(record_desc, ARRAY_LEN(record_desc), &record, &stream);
+    }
+
+    batch = (BitBatch_T) {
+        .p_buffer   = input,
+        .len        = sizeof(input),
+        .mode       = mode,
+        .record_len = RECORD_LEN,
+        .no_records = NO_RECORDS,
+    };
+}
+
+void setUp(void) {
+    make_records(BIG);
+}
+
+void test_eq_and_range(void) {
+    BitPredicate_T predicates[] = {
+        {.field = 0, .op = BIT_PREDICATE_EQ, .a = 3},
+        {.field = 1, .op = BIT_PREDICATE_RANGE, .a = 100, .b = 500},
+    };
+    BitFilterTerm_T terms[ARRAY_LEN(predicates)];
+    BitFilter_T filter;
+
+    Status_T result1 = BitFilter_Compile(&filter, record_desc, ARRAY_LEN(record_desc), predicates,
+                                         ARRAY_LEN(predicates), BIT_FILTER_AND, BIG, terms);
+    size_t indices[NO_RECORDS], no_found;
+    Status_T result2 = BitFilter_Scan(&filter, &batch, 0, indices, NO_RECORDS, &no_found);
+
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result1);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result2);
+    TEST_ASSERT_EQUAL(1, no_found);
+    TEST_ASSERT_EQUAL(3, indices[0]);
+}
+
+void test_or_with_mask(void) {
+    BitPredicate_T predicates[] = {
+        {.field = 4, .op = BIT_PREDICATE_MASK, .a = 0x03, .b = 0x03},
+        {.field = 3, .op = BIT_PREDICATE_EQ, .a = 0xF123456789ABCDE0u},
+    };
+    BitFilterTerm_T terms[ARRAY_LEN(predicates)];
+    BitFilter_T filter;
+
+    BitFilter_Compile(&filter, record_desc, ARRAY_LEN(record_desc), predicates, ARRAY_LEN(predicates),
+                      BIT_FILTER_OR, BIG, terms);
+    size_t indices[NO_RECORDS], no_found;
+    Status_T result = BitFilter_Scan(&filter, &batch, 0, indices, NO_RECORDS, &no_found);
+
+    // flags = 0, 3, 6, 9, 12, 15, 18, 21
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(3, no_found);
+    TEST_ASSERT_EQUAL(0, indices[0]);
+    TEST_ASSERT_EQUAL(1, indices[1]);
+    TEST_ASSERT_EQUAL(5, indices[2]);
+}
+
+void test_scan_continues(void) {
+    BitPredicate_T predicates[] = {
+        {.field = 0, .op = BIT_PREDICATE_RANGE, .a = 1, .b = 2},
+    };
+    BitFilterTerm_T terms[ARRAY_LEN(predicates)];
+    BitFilter_T filter;
+
+    BitFilter_Compile(&filter, record_desc, ARRAY_LEN(record_desc), predicates, ARRAY_LEN(predicates),
+                      BIT_FILTER_AND, BIG, terms);
+    size_t indices[3], no_found1, no_found2;
+    BitFilter_Scan(&filter, &batch, 0, indices, 3, &no_found1);
+    size_t last = indices[2];
+    BitFilter_Scan(&filter, &batch, last + 1, indices, 3, &no_found2);
+
+    TEST_ASSERT_EQUAL(3, no_found1);
+    TEST_ASSERT_EQUAL(5, last);
+    TEST_ASSERT_EQUAL(1, no_found2);
+    TEST_ASSERT_EQUAL(6, indices[0]);
+}
+
+void test_little_mode_wide_field(void) {
+    make_records(LITTLE);
+    BitPredicate_T predicates[] = {
+        {.field = 3, .op = BIT_PREDICATE_EQ, .a = 0xF123456789ABCDE4u},
+        {.field = 1, .op = BIT_PREDICATE_EQ, .a = 400},
+    };
+    BitFilterTerm_T terms[ARRAY_LEN(predicates)];
+    BitFilter_T filter;
+
+    BitFilter_Compile(&filter, record_desc, ARRAY_LEN(record_desc), predicates, ARRAY_LEN(predicates),
+                      BIT_FILTER_AND, LITTLE, terms);
+    size_t indices[NO_RECORDS], no_found;
+    BitFilter_Scan(&filter, &batch, 0, indices, NO_RECORDS, &no_found);
+
+    TEST_ASSERT_EQUAL(1, no_found);
+    TEST_ASSERT_EQUAL(4, indices[0]);
+}
+
+void test_variable_prefix_is_rejected(void) {
+    typedef struct {
+        size_t    len;
+        uint8_t * data;
+        uint8_t   status;
+    } Msg_T;
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_LEN(8, Msg_T, len),
+        BIT_FIELD_ARRAY_VARIABLE(Msg_T, data, len),
+        BIT_FIELD_U8(4, Msg_T, status),
+    };
+    BitPredicate_T predicates[] = {
+        {.field = 2, .op = BIT_PREDICATE_EQ, .a = 1},
+    };
+    BitFilterTerm_T terms[ARRAY_LEN(predicates)];
+    BitFilter_T filter;
+
+    Status_T result = BitFilter_Compile(&filter, msg_desc, ARRAY_LEN(msg_desc), predicates, ARRAY_LEN(predicates),
+                                        BIT_FILTER_AND, BIG, terms);
+
+    TEST_ASSERT_EQUAL(ERROR_DESCRIPTOR_INVALID, result);
+}
@@ -0,0 +1,121 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "BitParallel.h"
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+#define NO_RECORDS 10000
+
+typedef struct {
+    uint16_t channel;
+    uint8_t  status;
+    uint32_t time;
+} Record_T;
+
+static const BitField_T record_desc[] = {
+    BIT_FIELD_U16(12, Record_T, channel),
+    BIT_FIELD_U8(4, Record_T, status),
+    BIT_FIELD_U32(32, Record_T, time),
+};
+
+#define RECORD_LEN 6
+
+static uint8_t  input[NO_RECORDS * RECORD_LEN];
+static Record_T output[NO_RECORDS];
+
+void setUp(void) {
+    for(size_t i = 0; i < NO_RECORDS; i++) {
+        Record_T record = {.channel = (uint16_t) (i % 4096), .status = (uint8_t) (i % 16), .time = (uint32_t) i * 7};
+        Stream_T stream;
+        Stream_Init(&stream, input + i * RECORD_LEN, RECORD_LEN, BIG);
+        BitParser_Serialize(record_desc, ARRAY_LEN(record_desc), &record, &stream);
+    }
+
+    memset(output, 0, sizeof(output));
+}
+
+static void check_output(void) {
+    for(size_t i = 0; i < NO_RECORDS; i++) {
+        TEST_ASSERT_EQUAL(i % 4096, output[i].channel);
+        TEST_ASSERT_EQUAL(i % 16, output[i].status);
+        TEST_ASSERT_EQUAL(i * 7, output[i].time);
+    }
+}
+
+static BitBatch_T make_batch(void) {
+    BitBatch_T batch = {
+        .p_buffer    = input,
+        .len         = sizeof(input),
+        .mode        = BIG,
+        .record_len  = RECORD_LEN,
+        .no_records  = NO_RECORDS,
+        .p_output    = output,
+        .output_size = sizeof(Record_T),
+    };
+
+    return batch;
+}
+
+void test_single_thread(void) {
+    BitBatch_T batch = make_batch();
+
+    Status_T result = BitParallel_DeserializeBatch(record_desc, ARRAY_LEN(record_desc), &batch, 1, 0);
+
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    check_output();
+}
+
+void test_many_threads_small_chunks(void) {
+    BitBatch_T batch = make_batch();
+
+    Status_T result = BitParallel_DeserializeBatch(record_desc, ARRAY_LEN(record_desc), &batch, 4, 7);
+
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    check_output();
+}
+
+void test_error_is_reported(void) {
+    BitBatch_T batch = make_batch();
+    batch.len -= 1;
+
+    Status_T result = BitParallel_DeserializeBatch(record_desc, ARRAY_LEN(record_desc), &batch, 4, 100);
+
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, result);
+}
+
+void test_thread_count_is_clamped(void) {
+    BitBatch_T batch = make_batch();
+
+    Status_T result = BitParallel_DeserializeBatch(record_desc, ARRAY_LEN(record_desc), &batch, SIZE_MAX, 7);
+
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    check_output();
+}
@@ -324,3 +324,1185 @@ void test_misc_decode(void) {
     TEST_ASSERT_EQUAL(output.flags, 0x0003);
     TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
 }
+
+void test_deserialize_columns(void) {
+    //Given
+    typedef struct {
+        uint8_t  type;
+        uint16_t channel;
+        uint8_t  flag;
+    } Record_T;
+
+    static const BitField_T record_desc[] = {
+        BIT_FIELD_U8(4, Record_T, type),
+        BIT_FIELD_U16(12, Record_T, channel),
+        BIT_FIELD_U8(1, Record_T, flag),
+        BIT_FIELD_ALIGN(),
+    };
+
+    uint8_t input[] = {
+        0x1A, 0xBC, 0x80,
+        0x2D, 0xEF, 0x00,
+        0x30, 0x01, 0x80,
+    };
+
+    //When
+    uint8_t  types[3];
+    uint16_t channels[3];
+    uint8_t  flags[3];
+    void * columns[] = {types, channels, flags, NULL};
+
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_DeserializeColumns(record_desc, ARRAY_LEN(record_desc), columns, 3, &stream);
+
+    //Then
+    uint8_t  expected_types[]    = {0x1, 0x2, 0x3};
+    uint16_t expected_channels[] = {0xABC, 0xDEF, 0x001};
+    uint8_t  expected_flags[]    = {1, 0, 1};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_types, types, 3);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(expected_channels, channels, 3);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_flags, flags, 3);
+    TEST_ASSERT_EQUAL(sizeof(input), Stream_Tell(&stream));
+
+    //When
+    Stream_Init(&stream, input, sizeof(input) - 1, BIG);
+    result = BitParser_DeserializeColumns(record_desc, ARRAY_LEN(record_desc), columns, 3, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, result);
+    TEST_ASSERT_EQUAL(0, Stream_TellBit(&stream));
+}
+
+void test_deserialize_columns_unsupported_field(void) {
+    //Given
+    typedef struct {
+        uint8_t type;
+        uint8_t sum;
+    } Record_T;
+
+    static const BitField_T record_desc[] = {
+        BIT_FIELD_U8(8, Record_T, type),
+        BIT_FIELD_SUM8(Record_T, sum, 0),
+    };
+
+    uint8_t input[] = {0x01, 0x01};
+
+    //When
+    uint8_t types[1];
+    uint8_t sums[1];
+    void * columns[] = {types, sums};
+
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_DeserializeColumns(record_desc, ARRAY_LEN(record_desc), columns, 1, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_DESCRIPTOR_INVALID, result);
+    TEST_ASSERT_EQUAL(0, Stream_TellBit(&stream));
+}
+
+void test_deserialize_batch_with_index(void) {
+    //Given
+    typedef struct {
+        size_t    len;
+        uint8_t * data;
+    } Record_T;
+
+    static const BitField_T record_desc[] = {
+        BIT_FIELD_LEN(8, Record_T, len),
+        BIT_FIELD_ARRAY_VARIABLE(Record_T, data, len),
+    };
+
+    uint8_t input[] = {0x01, 0xAA, 0x03, 0xBB, 0xCC, 0xDD, 0x02, 0xEE, 0xFF};
+    size_t  index[] = {0, 2, 6};
+
+    uint8_t  buffers[3][3];
+    Record_T records[3] = {{.data = buffers[0]}, {.data = buffers[1]}, {.data = buffers[2]}};
+
+    BitBatch_T batch = {
+        .p_buffer    = input,
+        .len         = sizeof(input),
+        .mode        = BIG,
+        .p_index     = index,
+        .no_records  = 3,
+        .p_output    = records,
+        .output_size = sizeof(Record_T),
+    };
+
+    //When
+    Status_T result = BitParser_DeserializeBatch(record_desc, ARRAY_LEN(record_desc), &batch, 0, 3);
+
+    //Then
+    uint8_t expected1[] = {0xBB, 0xCC, 0xDD};
+    uint8_t expected2[] = {0xEE, 0xFF};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(1, records[0].len);
+    TEST_ASSERT_EQUAL(3, records[1].len);
+    TEST_ASSERT_EQUAL(2, records[2].len);
+    TEST_ASSERT_EQUAL_HEX8(0xAA, buffers[0][0]);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected1, buffers[1], sizeof(expected1));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected2, buffers[2], sizeof(expected2));
+}
+
+void test_deserialize_selected(void) {
+    //Given
+    typedef struct {
+        uint8_t   type;
+        uint16_t  channel;
+        size_t    len;
+        uint8_t * data;
+        uint32_t  time;
+        uint8_t   flags;
+    } Msg_T;
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_U8(4, Msg_T, type),
+        BIT_FIELD_U16(12, Msg_T, channel),
+        BIT_FIELD_LEN(8, Msg_T, len),
+        BIT_FIELD_ARRAY_VARIABLE(Msg_T, data, len),
+        BIT_FIELD_U32(32, Msg_T, time),
+        BIT_FIELD_PAD(2),
+        BIT_FIELD_U8(3, Msg_T, flags),
+    };
+
+    uint8_t input[] = {0x3A, 0xBC, 0x02, 0x11, 0x22, 0xDE, 0xAD, 0xBE, 0xEF, 0x28};
+
+    uint8_t mask[BIT_PARSER_MASK_SIZE(ARRAY_LEN(msg_desc))] = {0};
+    BIT_PARSER_MASK_SET(mask, 0);
+    BIT_PARSER_MASK_SET(mask, 6);
+
+    uint8_t array[2] = {0};
+    Msg_T msg = {.data = array};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_DeserializeSelected(msg_desc, ARRAY_LEN(msg_desc), mask, &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(0x3, msg.type);
+    TEST_ASSERT_EQUAL(0, msg.channel);
+    TEST_ASSERT_EQUAL(2, msg.len);
+    TEST_ASSERT_EQUAL_HEX8(0x00, array[0]);
+    TEST_ASSERT_EQUAL(0, msg.time);
+    TEST_ASSERT_EQUAL(0x5, msg.flags);
+    TEST_ASSERT_EQUAL(77, Stream_TellBit(&stream));
+
+    //When
+    Stream_Init(&stream, input, sizeof(input) - 1, BIG);
+    result = BitParser_DeserializeSelected(msg_desc, ARRAY_LEN(msg_desc), mask, &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, result);
+    TEST_ASSERT_EQUAL(0, Stream_TellBit(&stream));
+}
+
+void test_deserialize_selected_union_tag(void) {
+    //Given
+    typedef struct {
+        uint8_t tag;
+        union {
+            uint32_t value;
+        } body;
+        uint8_t tail;
+    } Tagged_T;
+
+    static const BitField_T value_desc[] = {
+        {.field_type = U32, .u32_f = {.offset = 0, .bit = 32}},
+    };
+
+    static const BitUnionCase_T tagged_cases[] = {
+        BIT_UNION_CASE(1, value_desc),
+    };
+
+    static const BitField_T tagged_desc[] = {
+        BIT_FIELD_U8(8, Tagged_T, tag),
+        BIT_FIELD_UNION(Tagged_T, body, tag, tagged_cases),
+        BIT_FIELD_U8(8, Tagged_T, tail),
+    };
+
+    uint8_t tagged_input[] = {0x01, 0x11, 0x22, 0x33, 0x44, 0x77};
+
+    uint8_t mask[BIT_PARSER_MASK_SIZE(ARRAY_LEN(tagged_desc))] = {0};
+    BIT_PARSER_MASK_SET(mask, 2);
+
+    Tagged_T tagged = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, tagged_input, sizeof(tagged_input), BIG);
+    Status_T result = BitParser_DeserializeSelected(tagged_desc, ARRAY_LEN(tagged_desc), mask, &tagged, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(1, tagged.tag);
+    TEST_ASSERT_EQUAL_HEX8(0x77, tagged.tail);
+    TEST_ASSERT_EQUAL(48, Stream_TellBit(&stream));
+    TEST_ASSERT_EQUAL(0, BitParser_FindUnionTag(tagged_desc, 1));
+}
+
+typedef struct {
+    uint8_t  version;
+    uint16_t id;
+} Header_T;
+
+typedef struct {
+    uint8_t  kind;
+    Header_T header;
+    uint16_t value;
+} Packet_T;
+
+static const BitField_T header_desc[] = {
+    BIT_FIELD_U8(4, Header_T, version),
+    BIT_FIELD_U16(12, Header_T, id),
+};
+
+static const BitField_T packet_desc[] = {
+    BIT_FIELD_U8(8, Packet_T, kind),
+    BIT_FIELD_SUBMSG(Packet_T, header, header_desc),
+    BIT_FIELD_U16(16, Packet_T, value),
+};
+
+void test_submsg(void) {
+    //Given
+    uint8_t  input[]   = {0x55, 0xAB, 0xCD, 0x12, 0x34};
+    uint8_t  output[5] = {0};
+    Packet_T packet    = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_Deserialize(packet_desc, ARRAY_LEN(packet_desc), &packet, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_HEX8(0x55, packet.kind);
+    TEST_ASSERT_EQUAL_HEX8(0xA, packet.header.version);
+    TEST_ASSERT_EQUAL_HEX16(0xBCD, packet.header.id);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, packet.value);
+    TEST_ASSERT_EQUAL(40, BitParser_GetLengthBit(packet_desc, ARRAY_LEN(packet_desc), &packet));
+
+    //When
+    Stream_Init(&stream, output, sizeof(output), BIG);
+    result = BitParser_Serialize(packet_desc, ARRAY_LEN(packet_desc), &packet, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(input, output, sizeof(input));
+}
+
+void test_flatten(void) {
+    //Given
+    BitField_T flat_desc[4];
+    size_t     no_flat = 0;
+    uint8_t    input[] = {0x55, 0xAB, 0xCD, 0x12, 0x34};
+    Packet_T   packet  = {0};
+
+    //When
+    Status_T result = BitParser_Flatten(packet_desc, ARRAY_LEN(packet_desc), flat_desc, 3, &no_flat);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_BUFFER_TOO_SHORT, result);
+
+    //When
+    result = BitParser_Flatten(packet_desc, ARRAY_LEN(packet_desc), flat_desc, ARRAY_LEN(flat_desc), &no_flat);
+
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T parse_result = BitParser_Deserialize(flat_desc, no_flat, &packet, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(4, no_flat);
+    TEST_ASSERT_EQUAL(offsetof(Packet_T, header) + offsetof(Header_T, id), flat_desc[2].u16_f.offset);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, parse_result);
+    TEST_ASSERT_EQUAL_HEX8(0x55, packet.kind);
+    TEST_ASSERT_EQUAL_HEX8(0xA, packet.header.version);
+    TEST_ASSERT_EQUAL_HEX16(0xBCD, packet.header.id);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, packet.value);
+}
+
+void test_union(void) {
+    //Given
+    typedef struct {
+        uint16_t sequence;
+    } Ping_T;
+
+    typedef struct {
+        uint8_t  channel;
+        uint32_t value;
+    } Sample_T;
+
+    typedef struct {
+        uint8_t type;
+        union {
+            Ping_T   ping;
+            Sample_T sample;
+            uint8_t  error;
+        } body;
+    } Frame_T;
+
+    static const BitField_T ping_desc[] = {
+        BIT_FIELD_U16(16, Ping_T, sequence),
+    };
+
+    static const BitField_T sample_desc[] = {
+        BIT_FIELD_U8(4, Sample_T, channel),
+        BIT_FIELD_U32(20, Sample_T, value),
+    };
+
+    static const BitField_T error_desc[] = {
+        {.field_type = U8, .u8_f = {.offset = 0, .bit = 8}},
+    };
+
+    static const BitUnionCase_T frame_cases[] = {
+        BIT_UNION_CASE(0, ping_desc),
+        BIT_UNION_CASE(1, sample_desc),
+        BIT_UNION_CASE(0x80, error_desc),
+    };
+
+    static const BitField_T frame_desc[] = {
+        BIT_FIELD_U8(8, Frame_T, type),
+        BIT_FIELD_UNION(Frame_T, body, type, frame_cases),
+    };
+
+    uint8_t ping_input[]    = {0x00, 0x12, 0x34};
+    uint8_t sample_input[]  = {0x01, 0x5A, 0xBC, 0xDE};
+    uint8_t error_input[]   = {0x80, 0x7F};
+    uint8_t unknown_input[] = {0x02, 0x00};
+    Frame_T ping = {0}, sample = {0}, error = {0}, unknown = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, ping_input, sizeof(ping_input), BIG);
+    Status_T ping_result = BitParser_Deserialize(frame_desc, ARRAY_LEN(frame_desc), &ping, &stream);
+    Stream_Init(&stream, sample_input, sizeof(sample_input), BIG);
+    Status_T sample_result = BitParser_Deserialize(frame_desc, ARRAY_LEN(frame_desc), &sample, &stream);
+    Stream_Init(&stream, error_input, sizeof(error_input), BIG);
+    Status_T error_result = BitParser_Deserialize(frame_desc, ARRAY_LEN(frame_desc), &error, &stream);
+    Stream_Init(&stream, unknown_input, sizeof(unknown_input), BIG);
+    Status_T unknown_result = BitParser_Deserialize(frame_desc, ARRAY_LEN(frame_desc), &unknown, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, ping_result);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, ping.body.ping.sequence);
+    TEST_ASSERT_EQUAL(24, BitParser_GetLengthBit(frame_desc, ARRAY_LEN(frame_desc), &ping));
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, sample_result);
+    TEST_ASSERT_EQUAL_HEX8(0x5, sample.body.sample.channel);
+    TEST_ASSERT_EQUAL_HEX32(0xABCDE, sample.body.sample.value);
+    TEST_ASSERT_EQUAL(32, BitParser_GetLengthBit(frame_desc, ARRAY_LEN(frame_desc), &sample));
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, error_result);
+    TEST_ASSERT_EQUAL_HEX8(0x7F, error.body.error);
+    TEST_ASSERT_EQUAL(ERROR_UNION_TAG_UNKNOWN, unknown_result);
+    TEST_ASSERT_NULL(BitParser_FindUnionCase(&frame_desc[1], 0x7F));
+    TEST_ASSERT_EQUAL_PTR(&frame_cases[2], BitParser_FindUnionCase(&frame_desc[1], 0x80));
+}
+
+void test_repeated(void) {
+    //Given
+    typedef struct {
+        uint8_t x;
+        uint8_t y;
+    } Point_T;
+
+    typedef struct {
+        size_t    count;
+        Point_T * points;
+        uint16_t  crc;
+    } Path_T;
+
+    static const BitField_T point_desc[] = {
+        BIT_FIELD_U8(4, Point_T, x),
+        BIT_FIELD_U8(4, Point_T, y),
+    };
+
+    static const BitField_T path_desc[] = {
+        BIT_FIELD_LEN(8, Path_T, count),
+        BIT_FIELD_REPEATED(Path_T, points, count, point_desc),
+        BIT_FIELD_U16(16, Path_T, crc),
+    };
+
+    uint8_t input[]      = {0x03, 0x12, 0x34, 0x56, 0xBE, 0xEF};
+    uint8_t truncated[]  = {0x03, 0x12, 0x34};
+    uint8_t output[6]    = {0};
+    Point_T points[3]    = {0};
+    Point_T untouched[3] = {0};
+    Path_T  path         = {.points = points};
+    Path_T  short_path   = {.points = untouched};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_Deserialize(path_desc, ARRAY_LEN(path_desc), &path, &stream);
+    Stream_Init(&stream, truncated, sizeof(truncated), BIG);
+    Status_T short_result = BitParser_Deserialize(path_desc, ARRAY_LEN(path_desc), &short_path, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(3, path.count);
+    TEST_ASSERT_EQUAL(1, points[0].x);
+    TEST_ASSERT_EQUAL(2, points[0].y);
+    TEST_ASSERT_EQUAL(5, points[2].x);
+    TEST_ASSERT_EQUAL(6, points[2].y);
+    TEST_ASSERT_EQUAL_HEX16(0xBEEF, path.crc);
+    TEST_ASSERT_EQUAL(48, BitParser_GetLengthBit(path_desc, ARRAY_LEN(path_desc), &path));
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, short_result);
+    TEST_ASSERT_EQUAL(0, untouched[0].x);
+
+    //When
+    Stream_Init(&stream, output, sizeof(output), BIG);
+    result = BitParser_Serialize(path_desc, ARRAY_LEN(path_desc), &path, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(input, output, sizeof(input));
+}
+
+void test_repeated_hostile_count(void) {
+    //Given
+    typedef struct {
+        uint8_t x;
+        uint8_t y;
+    } Point_T;
+
+    typedef struct {
+        size_t    count;
+        Point_T * points;
+    } Path_T;
+
+    static const BitField_T point_desc[] = {
+        BIT_FIELD_U8(4, Point_T, x),
+        BIT_FIELD_U8(4, Point_T, y),
+    };
+
+    static const BitField_T path_desc[] = {
+        BIT_FIELD_LEN(64, Path_T, count),
+        BIT_FIELD_REPEATED(Path_T, points, count, point_desc),
+    };
+
+    uint8_t input[]   = {0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12};
+    Point_T points[1] = {0};
+    Path_T  path      = {.points = points};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_Deserialize(path_desc, ARRAY_LEN(path_desc), &path, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, result);
+    TEST_ASSERT_EQUAL(0, Stream_TellBit(&stream));
+    TEST_ASSERT_EQUAL(0, points[0].x);
+    TEST_ASSERT_EQUAL(SIZE_MAX, BitParser_GetLengthBit(path_desc, ARRAY_LEN(path_desc), &path));
+}
+
+void test_length_profile(void) {
+    //Given
+    typedef struct {
+        uint8_t type;
+        float   ratio;
+        double  value;
+        uint8_t id[3];
+    } Fixed_T;
+
+    typedef struct {
+        uint8_t   type;
+        size_t    len;
+        uint8_t * data;
+        uint16_t  crc;
+    } Variable_T;
+
+    static const BitField_T fixed_desc[] = {
+        BIT_FIELD_U8(4, Fixed_T, type),
+        BIT_FIELD_ALIGN(),
+        BIT_FIELD_FLOAT(Fixed_T, ratio),
+        BIT_FIELD_DOUBLE(Fixed_T, value),
+        BIT_FIELD_ARRAY_FIXED(3, Fixed_T, id),
+        BIT_FIELD_ALIGN(),
+    };
+
+    static const BitField_T variable_desc[] = {
+        BIT_FIELD_U8(3, Variable_T, type),
+        BIT_FIELD_LEN(8, Variable_T, len),
+        BIT_FIELD_ARRAY_VARIABLE(Variable_T, data, len),
+        BIT_FIELD_ALIGN(),
+        BIT_FIELD_U16(16, Variable_T, crc),
+    };
+
+    uint8_t         array[2] = {0};
+    Variable_T      msg      = {.len = 2, .data = array};
+    BitLengthTerm_T terms[2];
+
+    BitLengthProfile_T fixed_profile;
+    BitLengthProfile_T variable_profile;
+
+    //When
+    Status_T fixed_result    = BitParser_InitLengthProfile(&fixed_profile, fixed_desc, ARRAY_LEN(fixed_desc), NULL, 0);
+    Status_T short_result    = BitParser_InitLengthProfile(&variable_profile, variable_desc, ARRAY_LEN(variable_desc),
+                                                           terms, 1);
+    Status_T variable_result = BitParser_InitLengthProfile(&variable_profile, variable_desc, ARRAY_LEN(variable_desc),
+                                                           terms, ARRAY_LEN(terms));
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, fixed_result);
+    TEST_ASSERT_EQUAL(0, fixed_profile.no_terms);
+    TEST_ASSERT_EQUAL(8 + 32 + 64 + 24, BitParser_GetProfileLengthBit(&fixed_profile, NULL));
+    TEST_ASSERT_EQUAL(8 + 32 + 64 + 24, BitParser_GetLengthBit(fixed_desc, ARRAY_LEN(fixed_desc), NULL));
+    TEST_ASSERT_EQUAL(ERROR_BUFFER_TOO_SHORT, short_result);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, variable_result);
+    TEST_ASSERT_EQUAL(2, variable_profile.no_terms);
+    TEST_ASSERT_EQUAL(3 + 8 + 16 + 5 + 16, BitParser_GetProfileLengthBit(&variable_profile, &msg));
+    TEST_ASSERT_EQUAL(3 + 8 + 16 + 5 + 16, BitParser_GetLengthBit(variable_desc, ARRAY_LEN(variable_desc), &msg));
+    TEST_ASSERT_EQUAL(6, BitParser_GetProfileLength(&variable_profile, &msg));
+}
+
+void test_native_fields(void) {
+    //Given
+    typedef struct {
+        uint8_t  flags;
+        uint16_t address;
+        int16_t  offset;
+        uint32_t value;
+        uint8_t  nibble;
+        uint64_t time;
+    } Msg_T;
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_U8(8, Msg_T, flags),
+        BIT_FIELD_U16(16, Msg_T, address),
+        BIT_FIELD_I16(16, Msg_T, offset),
+        BIT_FIELD_U32(32, Msg_T, value),
+        BIT_FIELD_U8(4, Msg_T, nibble),
+        BIT_FIELD_ALIGN(),
+        BIT_FIELD_U64(64, Msg_T, time),
+    };
+
+    Msg_T msg = {
+        .flags   = 0xA5,
+        .address = 0x1234,
+        .offset  = -2,
+        .value   = 0xDEADBEEF,
+        .nibble  = 0x7,
+        .time    = 0x0102030405060708,
+    };
+
+    uint8_t big_expected[]    = {0xA5, 0x12, 0x34, 0xFF, 0xFE, 0xDE, 0xAD, 0xBE, 0xEF, 0x70,
+                                 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08};
+    uint8_t little_expected[] = {0xA5, 0x34, 0x12, 0xFE, 0xFF, 0xEF, 0xBE, 0xAD, 0xDE, 0x07,
+                                 0x08, 0x07, 0x06, 0x05, 0x04, 0x03, 0x02, 0x01};
+    uint8_t big_output[18]    = {0};
+    uint8_t little_output[18] = {0};
+    Msg_T   decoded           = {0};
+
+    //When
+    Stream_T big_stream;
+    Stream_Init(&big_stream, big_output, sizeof(big_output), BIG);
+    Status_T big_result = BitParser_Serialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &big_stream);
+    Stream_T little_stream;
+    Stream_Init(&little_stream, little_output, sizeof(little_output), LITTLE);
+    Status_T little_result = BitParser_Serialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &little_stream);
+
+    Stream_Init(&little_stream, little_output, sizeof(little_output), LITTLE);
+    Status_T decode_result = BitParser_Deserialize(msg_desc, ARRAY_LEN(msg_desc), &decoded, &little_stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, big_result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(big_expected, big_output, sizeof(big_expected));
+    TEST_ASSERT_EQUAL(144, Stream_TellBit(&big_stream));
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, little_result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(little_expected, little_output, sizeof(little_expected));
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, decode_result);
+    TEST_ASSERT_EQUAL_HEX8(0xA5, decoded.flags);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, decoded.address);
+    TEST_ASSERT_EQUAL(-2, decoded.offset);
+    TEST_ASSERT_EQUAL_HEX32(0xDEADBEEF, decoded.value);
+    TEST_ASSERT_EQUAL_HEX8(0x7, decoded.nibble);
+    TEST_ASSERT_TRUE(decoded.time == 0x0102030405060708);
+    TEST_ASSERT_EQUAL(144, Stream_TellBit(&little_stream));
+}
+
+void test_field_order(void) {
+    //Given
+    typedef struct {
+        uint8_t  type;
+        uint16_t address;
+        uint32_t count;
+        float    value;
+        int16_t  offset;
+    } Msg_T;
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_U8(4, Msg_T, type),
+        BIT_FIELD_U16_ORDER(16, Msg_T, address, BIT_ORDER_LITTLE),
+        BIT_FIELD_U32(28, Msg_T, count),
+        BIT_FIELD_FLOAT_ORDER(Msg_T, value, BIT_ORDER_WORD_SWAPPED),
+        BIT_FIELD_I16_ORDER(16, Msg_T, offset, BIT_ORDER_LITTLE),
+    };
+
+    // type 0xA, address 0x1234 little endian, count 0xBCDEF01, value 1.5f (0x3FC00000) as CDAB,
+    // offset -2 little endian
+    uint8_t input[]    = {0xA3, 0x41, 0x2B, 0xCD, 0xEF, 0x01, 0x00, 0x00, 0x3F, 0xC0, 0xFE, 0xFF};
+    uint8_t output[12] = {0};
+    Msg_T   msg        = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_Deserialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_HEX8(0xA, msg.type);
+    TEST_ASSERT_EQUAL_HEX16(0x1234, msg.address);
+    TEST_ASSERT_EQUAL_HEX32(0xBCDEF01, msg.count);
+    TEST_ASSERT_EQUAL_FLOAT(1.5f, msg.value);
+    TEST_ASSERT_EQUAL(-2, msg.offset);
+    TEST_ASSERT_EQUAL(BIG, Stream_GetMode(&stream));
+
+    //When
+    Stream_Init(&stream, output, sizeof(output), BIG);
+    result = BitParser_Serialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(input, output, sizeof(input));
+}
+
+void test_checksum_fields(void) {
+    //Given
+    typedef struct {
+        uint8_t * data;
+        uint16_t  crc16;
+        uint32_t  crc32;
+        uint8_t   sum;
+    } Msg_T;
+
+    static const BitField_T modbus_desc[] = {
+        BIT_FIELD_ARRAY_FIXED(9, Msg_T, data),
+        BIT_FIELD_CRC16(Msg_T, crc16, 0, 0x8005, 0xFFFF, 0x0000, true),
+    };
+
+    static const BitField_T crc32_desc[] = {
+        BIT_FIELD_ARRAY_FIXED(9, Msg_T, data),
+        BIT_FIELD_CRC32(Msg_T, crc32, 0, 0x04C11DB7, 0xFFFFFFFF, 0xFFFFFFFF, true),
+    };
+
+    static const BitField_T ccitt_desc[] = {
+        BIT_FIELD_ARRAY_FIXED(9, Msg_T, data),
+        BIT_FIELD_CRC16(Msg_T, crc16, 0, 0x1021, 0xFFFF, 0x0000, false),
+        BIT_FIELD_SUM8(Msg_T, sum, 0),
+    };
+
+    uint8_t data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    Msg_T   msg    = {.data = data};
+
+    uint8_t modbus_output[11] = {0};
+    uint8_t crc32_output[13]  = {0};
+    uint8_t ccitt_output[12]  = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, modbus_output, sizeof(modbus_output), LITTLE);
+    Status_T modbus_result = BitParser_Serialize(modbus_desc, ARRAY_LEN(modbus_desc), &msg, &stream);
+    Stream_Init(&stream, crc32_output, sizeof(crc32_output), LITTLE);
+    Status_T crc32_result = BitParser_Serialize(crc32_desc, ARRAY_LEN(crc32_desc), &msg, &stream);
+    Stream_Init(&stream, ccitt_output, sizeof(ccitt_output), BIG);
+    Status_T ccitt_result = BitParser_Serialize(ccitt_desc, ARRAY_LEN(ccitt_desc), &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, modbus_result);
+    TEST_ASSERT_EQUAL_HEX8(0x37, modbus_output[9]);
+    TEST_ASSERT_EQUAL_HEX8(0x4B, modbus_output[10]);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, crc32_result);
+    TEST_ASSERT_EQUAL_HEX32(0xCBF43926, msg.crc32);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, ccitt_result);
+    TEST_ASSERT_EQUAL_HEX16(0x29B1, msg.crc16);
+    TEST_ASSERT_EQUAL_HEX8(0xB7, msg.sum);
+    TEST_ASSERT_EQUAL_HEX8(0xB7, ccitt_output[11]);
+
+    //When
+    uint8_t decoded_data[9];
+    Msg_T   decoded = {.data = decoded_data};
+    Stream_Init(&stream, modbus_output, sizeof(modbus_output), LITTLE);
+    Status_T valid_result = BitParser_Deserialize(modbus_desc, ARRAY_LEN(modbus_desc), &decoded, &stream);
+    modbus_output[4] ^= 0x01;
+    Stream_Init(&stream, modbus_output, sizeof(modbus_output), LITTLE);
+    Status_T corrupted_result = BitParser_Deserialize(modbus_desc, ARRAY_LEN(modbus_desc), &decoded, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, valid_result);
+    TEST_ASSERT_EQUAL_HEX16(0x4B37, decoded.crc16);
+    TEST_ASSERT_EQUAL(ERROR_CHECKSUM_MISMATCH, corrupted_result);
+}
+
+void test_checksum_uncommon_polynomial(void) {
+    //Given
+    typedef struct {
+        uint8_t * data;
+        uint32_t  crc32;
+    } Msg_T;
+
+    static const BitField_T crc32c_desc[] = {
+        BIT_FIELD_ARRAY_FIXED(9, Msg_T, data),
+        BIT_FIELD_CRC32(Msg_T, crc32, 0, 0x1EDC6F41, 0xFFFFFFFF, 0xFFFFFFFF, true),
+    };
+
+    uint8_t data[]     = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    Msg_T   msg        = {.data = data};
+    uint8_t output[13] = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, output, sizeof(output), LITTLE);
+    Status_T result = BitParser_Serialize(crc32c_desc, ARRAY_LEN(crc32c_desc), &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_HEX32(0xE3069283, msg.crc32);
+}
+
+void test_checksum_relative_to_message(void) {
+    //Given
+    typedef struct {
+        uint8_t a;
+        uint8_t b;
+        uint8_t sum;
+    } Frame_T;
+
+    typedef struct {
+        uint8_t id;
+        Frame_T frame;
+    } Msg_T;
+
+    static const BitField_T frame_desc[] = {
+        BIT_FIELD_U8(8, Frame_T, a),
+        BIT_FIELD_U8(8, Frame_T, b),
+        BIT_FIELD_SUM8(Frame_T, sum, 0),
+    };
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_U8(8, Msg_T, id),
+        BIT_FIELD_SUBMSG(Msg_T, frame, frame_desc),
+    };
+
+    Frame_T frame = {.a = 1, .b = 2};
+    Msg_T   msg   = {.id = 0x10, .frame = {.a = 1, .b = 2}};
+
+    uint8_t frames[6] = {0};
+    uint8_t nested[4] = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, frames, sizeof(frames), BIG);
+    Status_T first_result  = BitParser_Serialize(frame_desc, ARRAY_LEN(frame_desc), &frame, &stream);
+    Status_T second_result = BitParser_Serialize(frame_desc, ARRAY_LEN(frame_desc), &frame, &stream);
+    Stream_Init(&stream, nested, sizeof(nested), BIG);
+    Status_T nested_result = BitParser_Serialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &stream);
+
+    //Then
+    uint8_t expected_frames[] = {0x01, 0x02, 0x03, 0x01, 0x02, 0x03};
+    uint8_t expected_nested[] = {0x10, 0x01, 0x02, 0x03};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, first_result);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, second_result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_frames, frames, sizeof(frames));
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, nested_result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected_nested, nested, sizeof(nested));
+
+    //When
+    Frame_T decoded;
+    Msg_T   decoded_msg;
+    Stream_Init(&stream, frames, sizeof(frames), BIG);
+    Stream_SeekBit(&stream, 3 * BITS_IN_BYTE);
+    Status_T frame_result = BitParser_Deserialize(frame_desc, ARRAY_LEN(frame_desc), &decoded, &stream);
+    Stream_Init(&stream, nested, sizeof(nested), BIG);
+    Status_T msg_result = BitParser_Deserialize(msg_desc, ARRAY_LEN(msg_desc), &decoded_msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, frame_result);
+    TEST_ASSERT_EQUAL(3, decoded.sum);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, msg_result);
+    TEST_ASSERT_EQUAL(3, decoded_msg.frame.sum);
+}
+
+void test_auto_len(void) {
+    //Given
+    typedef struct {
+        size_t    len;
+        uint8_t   id;
+        uint16_t  status;
+        size_t    count;
+        uint8_t * data;
+    } Msg_T;
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_LEN_AUTO(8, Msg_T, len),
+        BIT_FIELD_U8(8, Msg_T, id),
+        BIT_FIELD_U16(12, Msg_T, status),
+        BIT_FIELD_LEN(4, Msg_T, count),
+        BIT_FIELD_ARRAY_VARIABLE(Msg_T, data, count),
+    };
+
+    uint8_t data[]    = {0xAA, 0xBB, 0xCC};
+    Msg_T   msg       = {.len = 0xFF, .id = 0x11, .status = 0x234, .count = sizeof(data), .data = data};
+    uint8_t output[8] = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, output, sizeof(output), BIG);
+    Status_T result = BitParser_Serialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &stream);
+
+    //Then
+    uint8_t expected[] = {0x06, 0x11, 0x23, 0x43, 0xAA, 0xBB, 0xCC};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(6, msg.len);
+    TEST_ASSERT_EQUAL(56, Stream_TellBit(&stream));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, output, sizeof(expected));
+}
+
+void test_auto_len_under_checksum(void) {
+    //Given
+    typedef struct {
+        size_t   len;
+        uint8_t  a;
+        uint8_t  b;
+        uint16_t crc;
+        uint8_t  sum;
+    } Msg_T;
+
+    static const BitField_T auto_desc[] = {
+        BIT_FIELD_LEN_AUTO(8, Msg_T, len),
+        BIT_FIELD_U8(8, Msg_T, a),
+        BIT_FIELD_U8(8, Msg_T, b),
+        BIT_FIELD_CRC16(Msg_T, crc, 0, 0x8005, 0xFFFF, 0x0000, true),
+        BIT_FIELD_SUM8(Msg_T, sum, 3),
+    };
+
+    static const BitField_T fixed_desc[] = {
+        BIT_FIELD_LEN(8, Msg_T, len),
+        BIT_FIELD_U8(8, Msg_T, a),
+        BIT_FIELD_U8(8, Msg_T, b),
+        BIT_FIELD_CRC16(Msg_T, crc, 0, 0x8005, 0xFFFF, 0x0000, true),
+        BIT_FIELD_SUM8(Msg_T, sum, 3),
+    };
+
+    Msg_T   msg       = {.len = 0xFF, .a = 0x01, .b = 0x02};
+    Msg_T   reference = {.len = 5, .a = 0x01, .b = 0x02};
+    Msg_T   decoded;
+    uint8_t output[6]   = {0};
+    uint8_t expected[6] = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, output, sizeof(output), BIG);
+    Status_T serialize = BitParser_Serialize(auto_desc, ARRAY_LEN(auto_desc), &msg, &stream);
+    Stream_Init(&stream, output, sizeof(output), BIG);
+    Status_T deserialize = BitParser_Deserialize(auto_desc, ARRAY_LEN(auto_desc), &decoded, &stream);
+
+    //Then
+    Stream_Init(&stream, expected, sizeof(expected), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(fixed_desc, ARRAY_LEN(fixed_desc), &reference, &stream));
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, serialize);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, deserialize);
+    TEST_ASSERT_EQUAL(5, msg.len);
+    TEST_ASSERT_EQUAL_HEX16(reference.crc, msg.crc);
+    TEST_ASSERT_EQUAL_HEX8(reference.sum, msg.sum);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, output, sizeof(expected));
+    TEST_ASSERT_EQUAL_HEX16(msg.crc, decoded.crc);
+}
+
+void test_serialize_rollback(void) {
+    //Given
+    typedef struct {
+        uint8_t   id;
+        uint16_t  status;
+        size_t    count;
+        uint8_t * data;
+    } Msg_T;
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_U8(4, Msg_T, id),
+        BIT_FIELD_U16(12, Msg_T, status),
+        BIT_FIELD_LEN(8, Msg_T, count),
+        BIT_FIELD_ARRAY_VARIABLE(Msg_T, data, count),
+    };
+
+    uint8_t data[]    = {0xAA, 0xBB, 0xCC, 0xDD};
+    Msg_T   msg       = {.id = 0x1, .status = 0x234, .count = sizeof(data), .data = data};
+    uint8_t output[6] = {0x50, 0x00, 0x00, 0x00, 0x00, 0x00};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, output, sizeof(output), BIG);
+    Stream_SeekBit(&stream, 4);
+    Status_T result = BitParser_Serialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, result);
+    TEST_ASSERT_EQUAL(4, Stream_TellBit(&stream));
+    TEST_ASSERT_EQUAL_HEX8(0x50, output[0]);
+}
+
+void test_whole_msg(void) {
+    //Given
+    typedef struct {
+        size_t    len;
+        uint8_t   slave_id;
+        uint8_t   status;
+        uint8_t * data;
+    } Msg_T;
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_LEN(8, Msg_T, len),
+        BIT_FIELD_U8(8, Msg_T, slave_id),
+        BIT_FIELD_U8(8, Msg_T, status),
+        BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG(Msg_T, data, len),
+    };
+
+    uint8_t input[] = {0x05, 0x11, 0xFF, 0xAA, 0xBB, 0xCC, 0x00};
+    Msg_T   msg     = {0};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_Deserialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(5, msg.len);
+    TEST_ASSERT_EQUAL_HEX8(0x11, msg.slave_id);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, msg.status);
+    TEST_ASSERT_EQUAL_PTR(&input[3], msg.data);
+    TEST_ASSERT_EQUAL(48, Stream_TellBit(&stream));
+    TEST_ASSERT_EQUAL(48, BitParser_GetLengthBit(msg_desc, ARRAY_LEN(msg_desc), &msg));
+
+    //When
+    uint8_t output[8] = {0};
+    Stream_Init(&stream, output, sizeof(output), BIG);
+    result = BitParser_Serialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(input, output, 6);
+}
+
+void test_whole_msg_not_aligned(void) {
+    //Given
+    typedef struct {
+        size_t    len;
+        uint8_t   flags;
+        uint8_t * data;
+    } Msg_T;
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_LEN(4, Msg_T, len),
+        BIT_FIELD_U8(4, Msg_T, flags),
+        BIT_FIELD_PAD(4),
+        BIT_FIELD_ARRAY_VARIABLE_WHOLE_MSG(Msg_T, data, len),
+    };
+
+    uint8_t input[] = {0x3A, 0x0B, 0xCD, 0xE0};
+    uint8_t data[2] = {0};
+    Msg_T   msg     = {.data = data};
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_Deserialize(msg_desc, ARRAY_LEN(msg_desc), &msg, &stream);
+
+    //Then
+    uint8_t expected[] = {0xBC, 0xDE};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(3, msg.len);
+    TEST_ASSERT_EQUAL_HEX8(0x0A, msg.flags);
+    TEST_ASSERT_EQUAL_PTR(data, msg.data);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, data, sizeof(expected));
+    TEST_ASSERT_EQUAL(28, Stream_TellBit(&stream));
+}
+
+void test_deserialize_arena(void) {
+    //Given
+    typedef struct {
+        size_t    len;
+        uint8_t * name;
+    } Item_T;
+
+    typedef struct {
+        size_t   count;
+        Item_T * items;
+    } List_T;
+
+    static const BitField_T item_desc[] = {
+        BIT_FIELD_LEN(4, Item_T, len),
+        BIT_FIELD_ARRAY_VARIABLE(Item_T, name, len),
+    };
+
+    static const BitField_T list_desc[] = {
+        BIT_FIELD_LEN(4, List_T, count),
+        BIT_FIELD_REPEATED(List_T, items, count, item_desc),
+    };
+
+    uint8_t    input[]   = {0x21, 0xAA, 0x2B, 0xBC, 0xC0};
+    uint8_t    memory[64];
+    List_T     list      = {0};
+    BitArena_T arena;
+    BitArena_Init(&arena, memory, sizeof(memory));
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_DeserializeArena(list_desc, ARRAY_LEN(list_desc), &list, &stream, &arena);
+
+    //Then
+    uint8_t expected[] = {0xBB, 0xCC};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(2, list.count);
+    TEST_ASSERT_EQUAL(1, list.items[0].len);
+    TEST_ASSERT_EQUAL_HEX8(0xAA, list.items[0].name[0]);
+    TEST_ASSERT_EQUAL(2, list.items[1].len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, list.items[1].name, sizeof(expected));
+    TEST_ASSERT_TRUE((uint8_t *) list.items >= memory && (uint8_t *) list.items < memory + sizeof(memory));
+    TEST_ASSERT_EQUAL(0, (uintptr_t) list.items % _Alignof(Item_T));
+    TEST_ASSERT_EQUAL(36, Stream_TellBit(&stream));
+
+    //When
+    BitArena_T small;
+    BitArena_Init(&small, memory, 2 * sizeof(Item_T) + 1);
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    result = BitParser_DeserializeArena(list_desc, ARRAY_LEN(list_desc), &list, &stream, &small);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_BUFFER_TOO_SHORT, result);
+    TEST_ASSERT_EQUAL(0, BitArena_GetUsed(&small));
+    TEST_ASSERT_EQUAL(0, Stream_TellBit(&stream));
+}
+
+void test_deserialize_arena_hostile_count(void) {
+    //Given
+    typedef struct {
+        size_t    len;
+        uint8_t * name;
+    } Item_T;
+
+    typedef struct {
+        size_t   count;
+        Item_T * items;
+    } List_T;
+
+    static const BitField_T item_desc[] = {
+        BIT_FIELD_LEN(8, Item_T, len),
+        BIT_FIELD_ARRAY_VARIABLE(Item_T, name, len),
+    };
+
+    static const BitField_T list_desc[] = {
+        BIT_FIELD_LEN(64, List_T, count),
+        BIT_FIELD_REPEATED(List_T, items, count, item_desc),
+    };
+
+    uint8_t    input[] = {0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xAA};
+    uint8_t    memory[64];
+    List_T     list    = {0};
+    BitArena_T arena;
+    BitArena_Init(&arena, memory, sizeof(memory));
+
+    //When
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitParser_DeserializeArena(list_desc, ARRAY_LEN(list_desc), &list, &stream, &arena);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_BUFFER_TOO_SHORT, result);
+    TEST_ASSERT_EQUAL(0, BitArena_GetUsed(&arena));
+    TEST_ASSERT_EQUAL(0, Stream_TellBit(&stream));
+}
+
+void test_validate(void) {
+    //Given
+    typedef struct {
+        uint16_t  id;
+        size_t    len;
+        uint8_t * data;
+    } Msg_T;
+
+    static const BitField_T valid_desc[] = {
+        BIT_FIELD_U16_ORDER(16, Msg_T, id, BIT_ORDER_LITTLE),
+        BIT_FIELD_LEN(8, Msg_T, len),
+        BIT_FIELD_ARRAY_VARIABLE(Msg_T, data, len),
+    };
+
+    static const BitField_T too_wide_desc[] = {
+        {.field_type = U16, .u16_f = {.offset = offsetof(Msg_T, id), .bit = 17}},
+    };
+
+    static const BitField_T order_desc[] = {
+        {.field_type = U16, .order = BIT_ORDER_BIG, .u16_f = {.offset = offsetof(Msg_T, id), .bit = 12}},
+    };
+
+    static const BitField_T no_len_desc[] = {
+        BIT_FIELD_ARRAY_VARIABLE(Msg_T, data, len),
+        BIT_FIELD_LEN(8, Msg_T, len),
+    };
+
+    static const BitField_T unknown_desc[] = {
+        {.field_type = (BitFieldType_T) 0xFF},
+    };
+
+    //When
+    Status_T valid_result    = BitParser_Validate(valid_desc, ARRAY_LEN(valid_desc));
+    Status_T too_wide_result = BitParser_Validate(too_wide_desc, ARRAY_LEN(too_wide_desc));
+    Status_T order_result    = BitParser_Validate(order_desc, ARRAY_LEN(order_desc));
+    Status_T no_len_result   = BitParser_Validate(no_len_desc, ARRAY_LEN(no_len_desc));
+    Status_T unknown_result  = BitParser_Validate(unknown_desc, ARRAY_LEN(unknown_desc));
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, valid_result);
+    TEST_ASSERT_EQUAL(ERROR_FIELD_WIDTH_INVALID, too_wide_result);
+    TEST_ASSERT_EQUAL(ERROR_FIELD_WIDTH_INVALID, order_result);
+    TEST_ASSERT_EQUAL(ERROR_LEN_FIELD_MISSING, no_len_result);
+    TEST_ASSERT_EQUAL(ERROR_FIELD_TYPE_UNKNOWN, unknown_result);
+}
+
+void test_error_context(void) {
+    //Given
+    typedef struct {
+        uint8_t  flags;
+        uint16_t id;
+        uint32_t time;
+    } Msg_T;
+
+    static const BitField_T msg_desc[] = {
+        BIT_FIELD_U8(4, Msg_T, flags),
+        BIT_FIELD_U16(12, Msg_T, id),
+        BIT_FIELD_U32(32, Msg_T, time),
+    };
+
+    Msg_T      msg       = {.flags = 0x1, .id = 0x234, .time = 0x56789ABC};
+    uint8_t    buffer[4] = {0};
+    BitError_T error     = {.field_index = SIZE_MAX};
+    Stream_T   stream;
+
+    //When
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    Status_T serialize_result = BitParser_SerializeEx(msg_desc, ARRAY_LEN(msg_desc), &msg, &stream, &error);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, serialize_result);
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, error.status);
+    TEST_ASSERT_EQUAL(2, error.field_index);
+    TEST_ASSERT_EQUAL(U32, error.field_type);
+    TEST_ASSERT_EQUAL(16, error.bit_offset);
+    TEST_ASSERT_EQUAL(32, error.bits_needed);
+    TEST_ASSERT_EQUAL(16, error.bits_available);
+    TEST_ASSERT_EQUAL(0, Stream_TellBit(&stream));
+
+    //When
+    error = (BitError_T) {.field_index = SIZE_MAX};
+    Stream_Init(&stream, buffer, 2, BIG);
+    Status_T deserialize_result = BitParser_DeserializeEx(msg_desc, 2, &msg, &stream, &error);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, deserialize_result);
+    TEST_ASSERT_EQUAL(SIZE_MAX, error.field_index);
+}
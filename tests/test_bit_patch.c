@@ -0,0 +1,201 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "BitPatch.h"
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+typedef struct {
+    uint16_t  sequence;
+    size_t    len;
+    uint8_t * data;
+    uint32_t  time;
+} Frame_T;
+
+static const BitField_T frame_desc[] = {
+    BIT_FIELD_U16(12, Frame_T, sequence),
+    BIT_FIELD_PAD(4),
+    BIT_FIELD_LEN(8, Frame_T, len),
+    BIT_FIELD_ARRAY_VARIABLE(Frame_T, data, len),
+    BIT_FIELD_U32(20, Frame_T, time),
+    BIT_FIELD_ALIGN(),
+};
+
+void test_patch_fields(void) {
+    //Given
+    uint8_t payload[] = {0x11, 0x22, 0x33};
+    Frame_T frame     = {.sequence = 0x001, .len = sizeof(payload), .data = payload, .time = 0x12345};
+
+    uint8_t  buffer[9]   = {0};
+    uint8_t  expected[9] = {0};
+    size_t   offsets[ARRAY_LEN(frame_desc) + 1];
+    Stream_T stream;
+
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(frame_desc, ARRAY_LEN(frame_desc), &frame, &stream));
+
+    BitPatch_T patch;
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    BitPatch_Init(&patch, frame_desc, ARRAY_LEN(frame_desc), &stream, offsets);
+
+    //When
+    frame.sequence = 0xABC;
+    frame.time     = 0xFEDCB;
+    Status_T sequence_result = BitPatch_Field(&patch, 0, &frame);
+    Status_T time_result     = BitPatch_Field(&patch, 4, &frame);
+
+    //Then
+    Stream_Init(&stream, expected, sizeof(expected), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(frame_desc, ARRAY_LEN(frame_desc), &frame, &stream));
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, sequence_result);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, time_result);
+    TEST_ASSERT_EQUAL(3, patch.no_fixed);
+    TEST_ASSERT_EQUAL(48, BitPatch_GetOffsetBit(&patch, 4, &frame));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buffer, sizeof(expected));
+}
+
+void test_patch_updates_checksum(void) {
+    //Given
+    typedef struct {
+        uint16_t sequence;
+        uint8_t  flags;
+        uint16_t crc;
+    } Packet_T;
+
+    static const BitField_T packet_desc[] = {
+        BIT_FIELD_U16(16, Packet_T, sequence),
+        BIT_FIELD_U8(8, Packet_T, flags),
+        BIT_FIELD_CRC16(Packet_T, crc, 0, 0x1021, 0xFFFF, 0x0000, false),
+    };
+
+    Packet_T packet      = {.sequence = 1, .flags = 0x5A};
+    uint8_t  buffer[5]   = {0};
+    uint8_t  expected[5] = {0};
+    size_t   offsets[ARRAY_LEN(packet_desc) + 1];
+    Stream_T stream;
+
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(packet_desc, ARRAY_LEN(packet_desc), &packet, &stream));
+
+    BitPatch_T patch;
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    BitPatch_Init(&patch, packet_desc, ARRAY_LEN(packet_desc), &stream, offsets);
+
+    //When
+    packet.sequence = 2;
+    Status_T result = BitPatch_Field(&patch, 0, &packet);
+
+    //Then
+    Stream_Init(&stream, expected, sizeof(expected), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(packet_desc, ARRAY_LEN(packet_desc), &packet, &stream));
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buffer, sizeof(expected));
+}
+
+void test_patch_updates_checksum_at_offset(void) {
+    //Given
+    typedef struct {
+        uint8_t a;
+        uint8_t sum;
+    } Frame_T;
+
+    static const BitField_T frame_desc[] = {
+        BIT_FIELD_U8(8, Frame_T, a),
+        BIT_FIELD_SUM8(Frame_T, sum, 0),
+    };
+
+    Frame_T  frame     = {.a = 1};
+    uint8_t  buffer[4] = {0};
+    size_t   offsets[ARRAY_LEN(frame_desc) + 1];
+    Stream_T stream;
+
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(frame_desc, ARRAY_LEN(frame_desc), &frame, &stream));
+    BitPatch_T patch;
+    BitPatch_Init(&patch, frame_desc, ARRAY_LEN(frame_desc), &stream, offsets);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(frame_desc, ARRAY_LEN(frame_desc), &frame, &stream));
+
+    //When
+    frame.a = 5;
+    Status_T result = BitPatch_Field(&patch, 0, &frame);
+
+    //Then
+    uint8_t expected[] = {0x01, 0x01, 0x05, 0x05};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buffer, sizeof(expected));
+}
+
+void test_patch_keeps_checksums_not_covering_field(void) {
+    //Given
+    typedef struct {
+        uint8_t a;
+        uint8_t sum_a;
+        uint8_t b;
+        uint8_t sum_b;
+        uint8_t c;
+        uint8_t sum_c;
+    } Frame_T;
+
+    static const BitField_T frame_desc[] = {
+        BIT_FIELD_U8(8, Frame_T, a),
+        BIT_FIELD_SUM8(Frame_T, sum_a, 0),
+        BIT_FIELD_U8(8, Frame_T, b),
+        BIT_FIELD_SUM8(Frame_T, sum_b, 2),
+        BIT_FIELD_U8(8, Frame_T, c),
+        BIT_FIELD_SUM8(Frame_T, sum_c, 4),
+    };
+
+    Frame_T  frame     = {.a = 1, .b = 2, .c = 3};
+    uint8_t  buffer[6] = {0};
+    size_t   offsets[ARRAY_LEN(frame_desc) + 1];
+    Stream_T stream;
+
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(frame_desc, ARRAY_LEN(frame_desc), &frame, &stream));
+    buffer[1]   = 0xAA;
+    buffer[5]   = 0xCC;
+    frame.sum_a = 0xAA;
+    frame.sum_c = 0xCC;
+
+    BitPatch_T patch;
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    BitPatch_Init(&patch, frame_desc, ARRAY_LEN(frame_desc), &stream, offsets);
+
+    //When
+    frame.b         = 7;
+    Status_T result = BitPatch_Field(&patch, 2, &frame);
+
+    //Then
+    uint8_t expected[] = {0x01, 0xAA, 0x07, 0x07, 0x03, 0xCC};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buffer, sizeof(expected));
+    TEST_ASSERT_EQUAL_HEX8(0xAA, frame.sum_a);
+    TEST_ASSERT_EQUAL_HEX8(0xCC, frame.sum_c);
+}
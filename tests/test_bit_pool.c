@@ -0,0 +1,141 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "BitPool.h"
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+typedef struct {
+    uint16_t  id;
+    size_t    len;
+    uint8_t * data;
+} Msg_T;
+
+static const BitField_T msg_desc[] = {
+    BIT_FIELD_U16(12, Msg_T, id),
+    BIT_FIELD_LEN(4, Msg_T, len),
+    BIT_FIELD_ARRAY_VARIABLE(Msg_T, data, len),
+};
+
+#define NO_SLOTS  20u
+#define DATA_SIZE 15u
+
+static _Alignas(max_align_t) uint8_t memory[NO_SLOTS * BIT_POOL_SLOT_SIZE(sizeof(Msg_T), DATA_SIZE)];
+
+void test_pool_data_size(void) {
+    TEST_ASSERT_EQUAL(DATA_SIZE, BitPool_GetDataSize(msg_desc, ARRAY_LEN(msg_desc)));
+}
+
+void test_pool_deserialize(void) {
+    //Given
+    BitPool_T      pool;
+    BitPoolCache_T cache;
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitPool_Init(&pool, msg_desc, ARRAY_LEN(msg_desc), sizeof(Msg_T), DATA_SIZE,
+                                                   memory, sizeof(memory)));
+    BitPool_InitCache(&cache, &pool);
+
+    uint8_t input[] = {0x12, 0x33, 0xAA, 0xBB, 0xCC};
+
+    //When
+    Msg_T *  p_msg;
+    Stream_T stream;
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    Status_T result = BitPool_Deserialize(&cache, &stream, (void **) &p_msg);
+
+    //Then
+    uint8_t expected[] = {0xAA, 0xBB, 0xCC};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_HEX16(0x123, p_msg->id);
+    TEST_ASSERT_EQUAL(3, p_msg->len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, p_msg->data, sizeof(expected));
+    TEST_ASSERT_TRUE(p_msg->data > (uint8_t *) p_msg && p_msg->data < (uint8_t *) p_msg + pool.slot_size);
+
+    //When
+    BitPool_Release(&cache, p_msg);
+    Msg_T * p_reused = BitPool_Acquire(&cache);
+
+    //Then
+    TEST_ASSERT_EQUAL_PTR(p_msg, p_reused);
+    TEST_ASSERT_EQUAL(0, p_reused->len);
+}
+
+void test_pool_exhausted(void) {
+    //Given
+    BitPool_T      pool;
+    BitPoolCache_T first, second;
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitPool_Init(&pool, msg_desc, ARRAY_LEN(msg_desc), sizeof(Msg_T), DATA_SIZE,
+                                                   memory, sizeof(memory)));
+    BitPool_InitCache(&first, &pool);
+    BitPool_InitCache(&second, &pool);
+
+    void * slots[NO_SLOTS];
+
+    //When
+    for(size_t i = 0; i < NO_SLOTS; i++)
+        slots[i] = BitPool_Acquire(i % 2 == 0 ? &first : &second);
+
+    void * p_none = BitPool_Acquire(&first);
+
+    //Then
+    TEST_ASSERT_NULL(p_none);
+    for(size_t i = 0; i < NO_SLOTS; i++) {
+        TEST_ASSERT_NOT_NULL(slots[i]);
+        for(size_t j = 0; j < i; j++)
+            TEST_ASSERT_TRUE(slots[i] != slots[j]);
+    }
+
+    //When
+    for(size_t i = 0; i < NO_SLOTS; i++)
+        BitPool_Release(&first, slots[i]);
+
+    BitPool_Flush(&first);
+    size_t no_acquired = 0;
+    while(BitPool_Acquire(&second) != NULL)
+        no_acquired++;
+
+    //Then
+    TEST_ASSERT_EQUAL(NO_SLOTS, no_acquired);
+}
+
+void test_pool_slot_size_overflow(void) {
+    //Given
+    BitPool_T pool;
+
+    //When
+    Status_T data_result   = BitPool_Init(&pool, msg_desc, ARRAY_LEN(msg_desc), sizeof(Msg_T), SIZE_MAX,
+                                          memory, sizeof(memory));
+    Status_T struct_result = BitPool_Init(&pool, msg_desc, ARRAY_LEN(msg_desc), SIZE_MAX - 64, 64,
+                                          memory, sizeof(memory));
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_BUFFER_TOO_SHORT, data_result);
+    TEST_ASSERT_EQUAL(ERROR_BUFFER_TOO_SHORT, struct_result);
+    TEST_ASSERT_EQUAL(0, pool.no_slots);
+}
@@ -0,0 +1,189 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "BitSchema.h"
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+typedef struct {
+    uint8_t  version;
+    uint16_t id;
+} Header_T;
+
+typedef struct {
+    Header_T  header;
+    size_t    len;
+    uint8_t * data;
+    int32_t   temperature;
+    double    value;
+} Device_T;
+
+static const char device_schema[] =
+    "# device profile\n"
+    "struct header {\n"
+    "    u8 4 version\n"
+    "    u16 12 id\n"
+    "}\n"
+    "len 8 len\n"
+    "bytes len data\n"
+    "i32 24 temperature le   # little endian\n"
+    "double value\n";
+
+static const BitField_T header_desc[] = {
+    BIT_FIELD_U8(4, Header_T, version),
+    BIT_FIELD_U16(12, Header_T, id),
+};
+
+static const BitField_T device_desc[] = {
+    BIT_FIELD_SUBMSG(Device_T, header, header_desc),
+    BIT_FIELD_LEN(8, Device_T, len),
+    BIT_FIELD_ARRAY_VARIABLE(Device_T, data, len),
+    BIT_FIELD_I32_ORDER(24, Device_T, temperature, BIT_ORDER_LITTLE),
+    BIT_FIELD_DOUBLE(Device_T, value),
+};
+
+void test_schema_parse(void) {
+    //Given
+    BitSchema_T schema;
+    BitField_T  fields[8];
+    size_t      line;
+
+    //When
+    Status_T result = BitSchema_Parse(&schema, device_schema, strlen(device_schema), fields, ARRAY_LEN(fields),
+                                      &line);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(6, schema.no_fields);
+    TEST_ASSERT_EQUAL(sizeof(Device_T), schema.size);
+    TEST_ASSERT_EQUAL(offsetof(Device_T, header.id), BitParser_GetFieldOffset(&fields[1]));
+    TEST_ASSERT_EQUAL(offsetof(Device_T, data), BitParser_GetFieldOffset(&fields[3]));
+    TEST_ASSERT_EQUAL(offsetof(Device_T, len), fields[3].array_variable_f.len_offset);
+    TEST_ASSERT_EQUAL(offsetof(Device_T, value), BitParser_GetFieldOffset(&fields[5]));
+
+    //When
+    uint8_t  payload[] = {0xAA, 0xBB};
+    Device_T device    = {.header = {.version = 3, .id = 0x123}, .len = sizeof(payload), .data = payload,
+                          .temperature = -5, .value = 0.25};
+    uint8_t  expected[16] = {0};
+    uint8_t  output[16]   = {0};
+    Stream_T stream;
+
+    Stream_Init(&stream, expected, sizeof(expected), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(device_desc, ARRAY_LEN(device_desc), &device, &stream));
+    Stream_Init(&stream, output, sizeof(output), BIG);
+    result = BitParser_Serialize(schema.p_fields, schema.no_fields, &device, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, output, sizeof(expected));
+}
+
+void test_schema_parse_errors(void) {
+    //Given
+    static const char * const schemas[] = {
+        "u8 9 value\n",
+        "u16 12 value be\n",
+        "bytes count data\n",
+        "len 8 count\nstruct inner {\n    bytes count data\n}\n",
+        "struct inner {\nu8 8 value\n",
+        "u8 8 value\n}\n",
+        "f32 value\n",
+    };
+    static const size_t lines[] = {1, 1, 1, 3, 2, 2, 1};
+
+    for(size_t i = 0; i < ARRAY_LEN(schemas); i++) {
+        BitSchema_T schema;
+        BitField_T  fields[8];
+        size_t      line = 0;
+
+        //When
+        Status_T result = BitSchema_Parse(&schema, schemas[i], strlen(schemas[i]), fields, ARRAY_LEN(fields), &line);
+
+        //Then
+        TEST_ASSERT_EQUAL(ERROR_DESCRIPTOR_INVALID, result);
+        TEST_ASSERT_EQUAL(lines[i], line);
+    }
+}
+
+void test_schema_image(void) {
+    //Given
+    BitSchema_T schema;
+    BitField_T  fields[8];
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitSchema_Parse(&schema, device_schema, strlen(device_schema), fields,
+                                                      ARRAY_LEN(fields), NULL));
+
+    BitField_T image[1 + ARRAY_LEN(fields)];
+    size_t     len = BIT_SCHEMA_IMAGE_SIZE(schema.no_fields);
+
+    //When
+    Status_T save_result = BitSchema_Save(&schema, (uint8_t *) image, len);
+
+    BitSchema_T mapped;
+    Status_T    map_result = BitSchema_Map(&mapped, image, len);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, save_result);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, map_result);
+    TEST_ASSERT_EQUAL(schema.no_fields, mapped.no_fields);
+    TEST_ASSERT_EQUAL(schema.size, mapped.size);
+    TEST_ASSERT_EQUAL_PTR((uint8_t *) image + sizeof(BitSchemaHeader_T), mapped.p_fields);
+    TEST_ASSERT_EQUAL_MEMORY(fields, mapped.p_fields, schema.no_fields * sizeof(BitField_T));
+
+    //When
+    Status_T short_result = BitSchema_Map(&mapped, image, len - 1);
+    ((BitField_T *) ((uint8_t *) image + sizeof(BitSchemaHeader_T)))[5].double_f.offset = schema.size;
+    Status_T invalid_result = BitSchema_Map(&mapped, image, len);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, short_result);
+    TEST_ASSERT_EQUAL(ERROR_DESCRIPTOR_INVALID, invalid_result);
+}
+
+void test_schema_image_word_swapped_width(void) {
+    //Given
+    BitSchema_T schema;
+    BitField_T  fields[8];
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitSchema_Parse(&schema, device_schema, strlen(device_schema), fields,
+                                                      ARRAY_LEN(fields), NULL));
+
+    BitField_T image[1 + ARRAY_LEN(fields)];
+    size_t     len = BIT_SCHEMA_IMAGE_SIZE(schema.no_fields);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitSchema_Save(&schema, (uint8_t *) image, len));
+
+    //When
+    ((BitField_T *) ((uint8_t *) image + sizeof(BitSchemaHeader_T)))[4].order = BIT_ORDER_WORD_SWAPPED;
+
+    BitSchema_T mapped;
+    Status_T    result = BitSchema_Map(&mapped, image, len);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_FIELD_WIDTH_INVALID, result);
+}
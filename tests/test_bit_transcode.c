@@ -0,0 +1,193 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+#include <math.h>
+
+#include "unity.h"
+
+#include "BitTranscode.h"
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+typedef struct {
+    uint8_t   type;
+    int16_t   value;
+    size_t    len;
+    uint8_t * data;
+} Device_T;
+
+typedef struct {
+    uint8_t   type;
+    int32_t   value;
+    size_t    len;
+    uint8_t * data;
+    uint16_t  reserved;
+    double    scaled;
+    uint8_t * id;
+} Wire_T;
+
+static const BitField_T device_desc[] = {
+    BIT_FIELD_U8(4, Device_T, type),
+    BIT_FIELD_I16(12, Device_T, value),
+    BIT_FIELD_LEN(8, Device_T, len),
+    BIT_FIELD_ARRAY_VARIABLE(Device_T, data, len),
+};
+
+static const BitField_T wire_desc[] = {
+    BIT_FIELD_U8(8, Wire_T, type),
+    BIT_FIELD_I32(32, Wire_T, value),
+    BIT_FIELD_LEN(8, Wire_T, len),
+    BIT_FIELD_ALIGN(),
+    BIT_FIELD_ARRAY_VARIABLE(Wire_T, data, len),
+    BIT_FIELD_U16(16, Wire_T, reserved),
+    BIT_FIELD_DOUBLE(Wire_T, scaled),
+    BIT_FIELD_ARRAY_FIXED(3, Wire_T, id),
+};
+
+static const size_t wire_map[] = {0, 1, 2, BIT_TRANSCODE_NONE, 3, BIT_TRANSCODE_NONE, 1, 3};
+
+void test_transcode(void) {
+    //Given
+    uint8_t input[]    = {0x5F, 0xFD, 0x02, 0xAB, 0xCD};
+    uint8_t output[21] = {0};
+    size_t  offsets[ARRAY_LEN(device_desc) + 1];
+
+    Stream_T source;
+    Stream_Init(&source, input, sizeof(input), BIG);
+    Stream_T target;
+    Stream_Init(&target, output, sizeof(output), LITTLE);
+
+    //When
+    Status_T result = BitTranscode_Message(device_desc, ARRAY_LEN(device_desc), &source,
+                                           wire_desc, ARRAY_LEN(wire_desc), &target, wire_map, offsets);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(40, Stream_TellBit(&source));
+    TEST_ASSERT_EQUAL(sizeof(output) * BITS_IN_BYTE, Stream_TellBit(&target));
+
+    uint8_t data[2] = {0};
+    uint8_t id[3]   = {0};
+    Wire_T  wire    = {.data = data, .id = id};
+    Stream_Init(&target, output, sizeof(output), LITTLE);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Deserialize(wire_desc, ARRAY_LEN(wire_desc), &wire, &target));
+    TEST_ASSERT_EQUAL(5, wire.type);
+    TEST_ASSERT_EQUAL(-3, wire.value);
+    TEST_ASSERT_EQUAL(2, wire.len);
+    TEST_ASSERT_EQUAL_HEX8(0xAB, data[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xCD, data[1]);
+    TEST_ASSERT_EQUAL(0, wire.reserved);
+    TEST_ASSERT_TRUE(wire.scaled == -3.0);
+    TEST_ASSERT_EQUAL_HEX8(0xAB, id[0]);
+    TEST_ASSERT_EQUAL_HEX8(0xCD, id[1]);
+    TEST_ASSERT_EQUAL_HEX8(0x00, id[2]);
+}
+
+void test_transcode_invalid_map(void) {
+    //Given
+    static const size_t invalid_map[] = {0, 3, 2, BIT_TRANSCODE_NONE, 3, BIT_TRANSCODE_NONE, 1, 3};
+
+    uint8_t input[]    = {0x5F, 0xFD, 0x02, 0xAB, 0xCD};
+    uint8_t output[21] = {0};
+    size_t  offsets[ARRAY_LEN(device_desc) + 1];
+
+    Stream_T source;
+    Stream_Init(&source, input, sizeof(input), BIG);
+    Stream_T target;
+    Stream_Init(&target, output, sizeof(output), LITTLE);
+
+    //When
+    Status_T result = BitTranscode_Message(device_desc, ARRAY_LEN(device_desc), &source,
+                                           wire_desc, ARRAY_LEN(wire_desc), &target, invalid_map, offsets);
+
+    //Then
+    TEST_ASSERT_EQUAL(ERROR_DESCRIPTOR_INVALID, result);
+    TEST_ASSERT_EQUAL(0, Stream_TellBit(&source));
+}
+
+void test_transcode_real_saturates(void) {
+    //Given
+    typedef struct {
+        float  high;
+        float  low;
+        float  nan;
+        double huge;
+    } Real_T;
+
+    typedef struct {
+        int16_t  high;
+        int16_t  low;
+        uint8_t  nan;
+        uint64_t huge;
+        uint8_t  negative;
+    } Integer_T;
+
+    static const BitField_T real_desc[] = {
+        BIT_FIELD_FLOAT(Real_T, high),
+        BIT_FIELD_FLOAT(Real_T, low),
+        BIT_FIELD_FLOAT(Real_T, nan),
+        BIT_FIELD_DOUBLE(Real_T, huge),
+    };
+
+    static const BitField_T integer_desc[] = {
+        BIT_FIELD_I16(16, Integer_T, high),
+        BIT_FIELD_I16(16, Integer_T, low),
+        BIT_FIELD_U8(8, Integer_T, nan),
+        BIT_FIELD_U64(64, Integer_T, huge),
+        BIT_FIELD_U8(8, Integer_T, negative),
+    };
+
+    static const size_t integer_map[] = {0, 1, 2, 3, 1};
+
+    Real_T  real = {.high = 1e30f, .low = -1e30f, .nan = NAN, .huge = 1.5e19};
+    uint8_t input[20];
+    uint8_t output[14];
+    size_t  offsets[ARRAY_LEN(real_desc) + 1];
+
+    Stream_T source;
+    Stream_Init(&source, input, sizeof(input), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(real_desc, ARRAY_LEN(real_desc), &real, &source));
+    Stream_Init(&source, input, sizeof(input), BIG);
+    Stream_T target;
+    Stream_Init(&target, output, sizeof(output), BIG);
+
+    //When
+    Status_T result = BitTranscode_Message(real_desc, ARRAY_LEN(real_desc), &source,
+                                           integer_desc, ARRAY_LEN(integer_desc), &target, integer_map, offsets);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+
+    Integer_T integer;
+    Stream_Init(&target, output, sizeof(output), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Deserialize(integer_desc, ARRAY_LEN(integer_desc), &integer, &target));
+    TEST_ASSERT_EQUAL_INT16(INT16_MAX, integer.high);
+    TEST_ASSERT_EQUAL_INT16(INT16_MIN, integer.low);
+    TEST_ASSERT_EQUAL_UINT8(0, integer.nan);
+    TEST_ASSERT_TRUE(integer.huge == 15000000000000000000u);
+    TEST_ASSERT_EQUAL_UINT8(0, integer.negative);
+}
@@ -0,0 +1,166 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "BitView.h"
+#include "BitParser.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+typedef struct {
+    uint8_t   type;
+    uint16_t  channel;
+    size_t    len;
+    uint8_t * data;
+    uint32_t  time;
+    uint8_t   flags;
+} Msg_T;
+
+static const BitField_T msg_desc[] = {
+    BIT_FIELD_U8(4, Msg_T, type),
+    BIT_FIELD_U16(12, Msg_T, channel),
+    BIT_FIELD_LEN(8, Msg_T, len),
+    BIT_FIELD_ARRAY_VARIABLE(Msg_T, data, len),
+    BIT_FIELD_U32(32, Msg_T, time),
+    BIT_FIELD_U8(3, Msg_T, flags),
+};
+
+static uint8_t input[] = {0x3A, 0xBC, 0x02, 0x11, 0x22, 0xDE, 0xAD, 0xBE, 0xEF, 0xA0};
+
+static Msg_T     msg;
+static uint8_t   array[4];
+static size_t    offsets[ARRAY_LEN(msg_desc) + 1];
+static uint8_t   decoded[BIT_VIEW_DECODED_SIZE(ARRAY_LEN(msg_desc))];
+static Stream_T  stream;
+static BitView_T view;
+
+void setUp(void) {
+    memset(&msg, 0, sizeof(msg));
+    memset(array, 0, sizeof(array));
+    msg.data = array;
+
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    BitView_Init(&view, msg_desc, ARRAY_LEN(msg_desc), &msg, &stream, offsets, decoded);
+}
+
+void test_get_single_field(void) {
+    Status_T result = BitView_Get(&view, 1);
+
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_HEX16(0xABC, msg.channel);
+    TEST_ASSERT_EQUAL(0, msg.type);
+    TEST_ASSERT_TRUE(BitView_IsDecoded(&view, 1));
+    TEST_ASSERT_FALSE(BitView_IsDecoded(&view, 0));
+    TEST_ASSERT_EQUAL(0, Stream_TellBit(&stream));
+}
+
+void test_get_field_after_variable_array(void) {
+    Status_T result = BitView_Get(&view, 4);
+
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL_HEX32(0xDEADBEEF, msg.time);
+    TEST_ASSERT_EQUAL(2, msg.len);
+    TEST_ASSERT_TRUE(BitView_IsDecoded(&view, 2));
+    TEST_ASSERT_FALSE(BitView_IsDecoded(&view, 3));
+    TEST_ASSERT_EQUAL_HEX8(0x00, array[0]);
+}
+
+void test_decoded_value_is_cached(void) {
+    BitView_Get(&view, 5);
+    msg.flags = 0;
+
+    Status_T result = BitView_Get(&view, 5);
+
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(0, msg.flags);
+}
+
+void test_offsets(void) {
+    size_t offset_array, offset_end;
+
+    Status_T result1 = BitView_GetOffsetBit(&view, 3, &offset_array);
+    Status_T result2 = BitView_GetOffsetBit(&view, ARRAY_LEN(msg_desc), &offset_end);
+
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result1);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result2);
+    TEST_ASSERT_EQUAL(24, offset_array);
+    TEST_ASSERT_EQUAL(75, offset_end);
+}
+
+void test_too_short(void) {
+    Stream_Init(&stream, input, 5, BIG);
+    BitView_Init(&view, msg_desc, ARRAY_LEN(msg_desc), &msg, &stream, offsets, decoded);
+
+    Status_T result = BitView_Get(&view, 4);
+
+    TEST_ASSERT_EQUAL(ERROR_STREAM_TOO_SHORT, result);
+}
+
+void test_get_field_after_union(void) {
+    //Given
+    typedef struct {
+        uint8_t tag;
+        union {
+            uint32_t value;
+        } body;
+        uint8_t tail;
+    } Tagged_T;
+
+    static const BitField_T value_desc[] = {
+        {.field_type = U32, .u32_f = {.offset = 0, .bit = 32}},
+    };
+
+    static const BitUnionCase_T tagged_cases[] = {
+        BIT_UNION_CASE(1, value_desc),
+    };
+
+    static const BitField_T tagged_desc[] = {
+        BIT_FIELD_U8(8, Tagged_T, tag),
+        BIT_FIELD_UNION(Tagged_T, body, tag, tagged_cases),
+        BIT_FIELD_U8(8, Tagged_T, tail),
+    };
+
+    uint8_t tagged_input[] = {0x01, 0x11, 0x22, 0x33, 0x44, 0x77};
+
+    Tagged_T  tagged = {0};
+    size_t    tagged_offsets[ARRAY_LEN(tagged_desc) + 1];
+    uint8_t   tagged_decoded[BIT_VIEW_DECODED_SIZE(ARRAY_LEN(tagged_desc))];
+    BitView_T tagged_view;
+
+    Stream_Init(&stream, tagged_input, sizeof(tagged_input), BIG);
+    BitView_Init(&tagged_view, tagged_desc, ARRAY_LEN(tagged_desc), &tagged, &stream, tagged_offsets, tagged_decoded);
+
+    //When
+    Status_T result = BitView_Get(&tagged_view, 2);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(1, tagged.tag);
+    TEST_ASSERT_EQUAL_HEX32(0x11223344, tagged.body.value);
+    TEST_ASSERT_EQUAL_HEX8(0x77, tagged.tail);
+}
@@ -0,0 +1,152 @@
+/*
+ * MIT License
+ *
+ * Copyright (c) 2019 Tomasz Szewczyk
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * SOFTWARE.
+ *
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "modbus.h"
+#include "BitParser.h"
+#include "BitView.h"
+#include "BitPatch.h"
+#include "Stream.h"
+#include "BitParserError.h"
+
+void test_report_slave_id_round_trip(void) {
+    //Given
+    uint8_t additional_data[] = {0x01, 0x02, 0x03};
+    modbus_report_slave_id_response_t response = {
+        .len = sizeof(additional_data), .slave_id = 0x11, .run_indicator_status = 0xFF,
+        .additional_data = additional_data
+    };
+    modbus_report_slave_id_response_t decoded;
+
+    uint8_t  buffer[8] = {0};
+    Stream_T stream;
+
+    //When
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    Status_T serialize = BitParser_Serialize(modbus_report_slave_id_response_desc,
+                                             ARRAY_LEN(modbus_report_slave_id_response_desc), &response, &stream);
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    Status_T deserialize = BitParser_Deserialize(modbus_report_slave_id_response_desc,
+                                                 ARRAY_LEN(modbus_report_slave_id_response_desc), &decoded, &stream);
+
+    //Then
+    uint8_t expected[] = {0x05, 0x11, 0xFF, 0x01, 0x02, 0x03};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, serialize);
+    TEST_ASSERT_EQUAL(5, response.len);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buffer, sizeof(expected));
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, deserialize);
+    TEST_ASSERT_EQUAL(48, Stream_TellBit(&stream));
+    TEST_ASSERT_EQUAL(5, decoded.len);
+    TEST_ASSERT_EQUAL(0x11, decoded.slave_id);
+    TEST_ASSERT_EQUAL(0xFF, decoded.run_indicator_status);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(additional_data, decoded.additional_data, sizeof(additional_data));
+}
+
+void test_report_slave_id_profile(void) {
+    //Given
+    uint8_t additional_data[] = {0x01, 0x02, 0x03};
+    modbus_report_slave_id_response_t response = {.len = 5, .additional_data = additional_data};
+
+    BitLengthTerm_T    terms[1];
+    BitLengthProfile_T profile;
+
+    //When
+    Status_T result = BitParser_InitLengthProfile(&profile, modbus_report_slave_id_response_desc,
+                                                  ARRAY_LEN(modbus_report_slave_id_response_desc), terms,
+                                                  ARRAY_LEN(terms));
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(1, profile.no_terms);
+    TEST_ASSERT_EQUAL(48, BitParser_GetProfileLengthBit(&profile, &response));
+    TEST_ASSERT_EQUAL(48, BitParser_GetLengthBit(modbus_report_slave_id_response_desc,
+                                                 ARRAY_LEN(modbus_report_slave_id_response_desc), &response));
+}
+
+void test_report_slave_id_view(void) {
+    //Given
+    uint8_t input[] = {0x05, 0x11, 0xFF, 0x01, 0x02, 0x03};
+
+    modbus_report_slave_id_response_t response = {0};
+
+    size_t   offsets[ARRAY_LEN(modbus_report_slave_id_response_desc) + 1];
+    uint8_t  decoded[BIT_VIEW_DECODED_SIZE(ARRAY_LEN(modbus_report_slave_id_response_desc))];
+    Stream_T stream;
+    BitView_T view;
+
+    Stream_Init(&stream, input, sizeof(input), BIG);
+    BitView_Init(&view, modbus_report_slave_id_response_desc, ARRAY_LEN(modbus_report_slave_id_response_desc),
+                 &response, &stream, offsets, decoded);
+
+    //When
+    size_t   offset_end;
+    Status_T offset_result = BitView_GetOffsetBit(&view, ARRAY_LEN(modbus_report_slave_id_response_desc),
+                                                  &offset_end);
+    Status_T get_result    = BitView_Get(&view, 2);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, offset_result);
+    TEST_ASSERT_EQUAL(48, offset_end);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, get_result);
+    TEST_ASSERT_EQUAL(5, response.len);
+    TEST_ASSERT_EQUAL(0xFF, response.run_indicator_status);
+}
+
+void test_report_slave_id_patch(void) {
+    //Given
+    uint8_t additional_data[] = {0x01, 0x02, 0x03};
+    modbus_report_slave_id_response_t response = {
+        .len = sizeof(additional_data), .slave_id = 0x11, .run_indicator_status = 0xFF,
+        .additional_data = additional_data
+    };
+
+    uint8_t  buffer[6] = {0};
+    size_t   offsets[ARRAY_LEN(modbus_report_slave_id_response_desc) + 1];
+    Stream_T stream;
+
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, BitParser_Serialize(modbus_report_slave_id_response_desc,
+                                                          ARRAY_LEN(modbus_report_slave_id_response_desc),
+                                                          &response, &stream));
+
+    BitPatch_T patch;
+    Stream_Init(&stream, buffer, sizeof(buffer), BIG);
+    BitPatch_Init(&patch, modbus_report_slave_id_response_desc, ARRAY_LEN(modbus_report_slave_id_response_desc),
+                  &stream, offsets);
+
+    //When
+    response.run_indicator_status = 0x00;
+    Status_T result = BitPatch_Field(&patch, 2, &response);
+
+    //Then
+    uint8_t expected[] = {0x05, 0x11, 0x00, 0x01, 0x02, 0x03};
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result);
+    TEST_ASSERT_EQUAL(3, patch.no_fixed);
+    TEST_ASSERT_EQUAL(24, BitPatch_GetOffsetBit(&patch, 3, &response));
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, buffer, sizeof(expected));
+}
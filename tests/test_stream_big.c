@@ -394,3 +394,18 @@ void test_write_half_a_byte_and_regular_write(void) {
     TEST_ASSERT_EQUAL((BUFFER_SIZE - sizeof(expected)) * 8, Stream_GetLeftBits(&stream));
     TEST_ASSERT_EQUAL(sizeof(expected) * 8, Stream_TellBit(&stream));
 }
+
+void test_checkpoint_restore(void) {
+    uint8_t new_data1[] = {0x0A};
+    uint8_t new_data2[] = {0xBB, 0xCC, 0xDD};
+    Stream_Checkpoint_T checkpoint;
+    Status_T result1 = Stream_WriteBit(&stream, new_data1, 4);
+    Stream_Checkpoint(&stream, &checkpoint);
+    Status_T result2 = Stream_WriteBit(&stream, new_data2, 20);
+    Stream_Restore(&stream, &checkpoint);
+
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result1);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result2);
+    TEST_ASSERT_EQUAL_HEX8(0xA0, buffer[0]);
+    TEST_ASSERT_EQUAL(4, Stream_TellBit(&stream));
+}
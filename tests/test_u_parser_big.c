@@ -868,6 +868,26 @@ void test_deserialize_i16_bit(void) {
     TEST_ASSERT_EQUAL(expected_data3, data3);
 }
 
+void test_deserialize_i32_bit_sign_extension(void) {
+    //Given
+    uint8_t input[] = {0xFF, 0xFF, 0xF8, 0x00, 0x00};
+    memcpy(stream.p_buffer, input, sizeof(input));
+
+    int32_t data1;
+    int32_t data2;
+
+    //When
+    Status_T result1 = I32_DeserializeBit(&data1, 20, &stream);
+    Status_T result2 = I32_DeserializeBit(&data2, 20, &stream);
+
+    //Then
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result1);
+    TEST_ASSERT_EQUAL(STATUS_SUCCESS, result2);
+
+    TEST_ASSERT_EQUAL_INT32(-1, data1);
+    TEST_ASSERT_EQUAL_INT32(-524288, data2);
+}
+
 void test_deserialize_s16_bit(void) {
     uint8_t input[] = {0x4E, 0x8E, 0xFD, 0xC6, 0xC0};
     memcpy(stream.p_buffer, input, sizeof(input));